@@ -0,0 +1,18 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "dmi/decoder.h"
+
+//libFuzzer entry: first two bytes are SMBIOS major and minor version, rest is structure table
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    if(size<2){
+        return 0;
+    }
+    decoder dmi_decoder {};
+    dmi_decoder.set_raw_format(raw_mode::unknown,raw_encoding::base64);
+    dmi_decoder.set_cache_topology(true);
+    dmi_decoder.set_memory_topology(true);
+    dmi_decoder.decode_information(reinterpret_cast<const char*>(data+2),size-2,data[0],data[1]);
+    return 0;
+}
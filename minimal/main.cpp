@@ -0,0 +1,196 @@
+//Minimal command line tool: decode path and built-in JSON writer only, no Qt, program_options or filesystem.
+//Built by DMIDECODER_MINIMAL profile as static LTO binary, for fleets where per-run startup outweighs decoding.
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+//Boost.JSON compiled into this binary instead of linking boost_json
+#include <boost/json/src.hpp>
+
+#include "status.h"
+#include "dmi/decoder.h"
+#include "dmi/writer.h"
+#include "dmi/identity.h"
+
+namespace {
+const char usage_text[] {
+    "Usage: dmidecoder_min [options]\n"
+    "  -h, --help           produce help message\n"
+    "  -i, --input <dir>    decode captured table from directory holding smbios_entry_point and DMI files\n"
+    "  -o, --output <file>  write records to file instead of standard output\n"
+    "  -l, --jsonl          host line, then one compact record per line, instead of indented records\n"
+    "  -t, --type <list>    decode only given structure types, e.g. \"-t 1,2,17\"\n"
+    "  -d, --identity       print system uuid, serial and product, baseboard and chassis serials only,\n"
+    "                       reading table up to their structures\n"
+    "Exit codes are those of dmidecoder.\n"};
+
+//structure types from comma separated list, false on value out of 0..255
+bool parse_types(const char* list, std::vector<int>& types)
+{
+    while(*list!='\0'){
+        if(*list==',' || *list==' '){
+            ++list;
+            continue;
+        }
+        char* end {nullptr};
+        const long type {std::strtol(list,&end,10)};
+        if(end==list || (*end!='\0' && *end!=',' && *end!=' ') || type < 0 || type > 255){
+            return false;
+        }
+        types.push_back(static_cast<int>(type));
+        list=end;
+    }
+    return true;
+}
+
+std::string host_name()
+{
+#if defined(_WIN32)
+    char name[MAX_COMPUTERNAME_LENGTH+1] {};
+    DWORD size {sizeof(name)};
+    return GetComputerNameA(name,&size) ? std::string {name,size} : std::string {};
+#else
+    char name[256] {};
+    return gethostname(name,sizeof(name)-1)==0 ? std::string {name} : std::string {};
+#endif
+}
+
+//identity record, keys as in decoded records of types 1, 2 and 3
+boost::json::object identity_object(const system_identity& identity)
+{
+    return boost::json::object {
+        {"object_type", "identity"},
+        {"uuid", identity.uuid_},
+        {"serial_number", identity.serial_number_},
+        {"product_name", identity.product_name_},
+        {"baseboard_serial_number", identity.baseboard_serial_number_},
+        {"chassis_serial_number", identity.chassis_serial_number_}
+    };
+}
+
+bool write_out(std::FILE* out, const std::string& text)
+{
+    return std::fwrite(text.data(),1,text.size(),out)==text.size();
+}
+}
+
+int main(int argc, char* argv[])
+{
+    std::string input {};
+    std::string output {};
+    bool jsonl {false};
+    bool identity_only {false};
+    std::vector<int> types {};
+    for(int i=1;i<argc;++i){
+        const char* option {argv[i]};
+        const bool& has_value {i+1<argc};
+        if(!std::strcmp(option,"-h") || !std::strcmp(option,"--help")){
+            std::fputs(usage_text,stdout);
+            return exit_code(exit_status::success);
+        }
+        else if(!std::strcmp(option,"-l") || !std::strcmp(option,"--jsonl")){
+            jsonl=true;
+        }
+        else if(!std::strcmp(option,"-d") || !std::strcmp(option,"--identity")){
+            identity_only=true;
+        }
+        else if((!std::strcmp(option,"-i") || !std::strcmp(option,"--input")) && has_value){
+            input=argv[++i];
+        }
+        else if((!std::strcmp(option,"-o") || !std::strcmp(option,"--output")) && has_value){
+            output=argv[++i];
+        }
+        else if((!std::strcmp(option,"-t") || !std::strcmp(option,"--type")) && has_value){
+            if(!parse_types(argv[++i],types)){
+                std::fputs("error: structure types must be numbers from 0 to 255\n",stderr);
+                return exit_code(exit_status::usage);
+            }
+        }
+        else{
+            std::fprintf(stderr,"error: unknown option or missing value %s\n%s",option,usage_text);
+            return exit_code(exit_status::usage);
+        }
+    }
+
+    std::FILE* out {output.empty() ? stdout : std::fopen(output.c_str(),"wb")};
+    if(!out){
+        std::fprintf(stderr,"error: can not open output file %s\n",output.c_str());
+        return exit_code(exit_status::output);
+    }
+
+    const std::string& directory {input.empty() || input.back()=='/' ? input : input+"/"};
+    bool written {true};
+    std::string text {};
+    if(jsonl){
+        const boost::json::object& host_object {
+            {"object_type", "host"},
+            {"host", input.empty() ? host_name() : input}
+        };
+        write_compact(text,host_object);
+        text.push_back('\n');
+        written=write_out(out,text) && std::fflush(out)==0;
+    }
+    //records are written as decoded, JSON lines are flushed so consumers can start before decode ends
+    const auto& write_record {[out,jsonl,&text,&written](const boost::json::object& json){
+            text.clear();
+            if(jsonl){
+                write_compact(text,json);
+            }
+            else{
+                write_pretty(text,json);
+            }
+            text.push_back('\n');
+            written=write_out(out,text) && (!jsonl || std::fflush(out)==0) && written;
+        }
+    };
+
+    exit_status status {exit_status::success};
+    if(identity_only){
+        //no decoder, table is read only up to first type 1, 2 and 3 structures
+        system_identity identity {};
+        const decode_error& error {input.empty() ? read_identity(identity) :
+                                                   read_identity(directory+"smbios_entry_point",directory+"DMI",identity)};
+        if(identity.system_ || identity.baseboard_ || identity.chassis_){
+            write_record(identity_object(identity));
+        }
+        if(error!=decode_error::ok){
+            std::fprintf(stderr,"error: %s\n",error_message(error));
+            status=error_status(error);
+        }
+        else if(!identity.system_ && !identity.baseboard_ && !identity.chassis_){
+            std::fputs("error: No structures decoded\n",stderr);
+            status=exit_status::no_structures;
+        }
+    }
+    else{
+        const std::unique_ptr<decoder> host_decoder {input.empty() ? new decoder {} :
+                                                                     new decoder {directory+"smbios_entry_point",directory+"DMI"}};
+        host_decoder->set_type_filter(types);
+        const std::size_t& count {host_decoder->decode_objects(write_record)};
+        if(!host_decoder->error().empty()){
+            std::fprintf(stderr,"error: %s\n",host_decoder->error().c_str());
+            status=error_status(host_decoder->error_code());
+        }
+        else if(count==0){
+            std::fputs("error: No structures decoded\n",stderr);
+            status=exit_status::no_structures;
+        }
+    }
+
+    written=std::fflush(out)==0 && written;
+    if(out!=stdout){
+        written=std::fclose(out)==0 && written;
+    }
+    if(!written){
+        std::fputs("error: fail to write output\n",stderr);
+        return exit_code(exit_status::output);
+    }
+    return exit_code(status);
+}
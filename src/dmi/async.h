@@ -0,0 +1,89 @@
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <boost/asio/post.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include "decoder.h"
+
+//Asynchronous decode for event loop callers, e.g.
+//  boost::asio::thread_pool workers {1};
+//  async_decode_information(io.get_executor(),workers.get_executor(),dmi,[](decode_result decoded){...});
+//  std::future<decode_result> decoded {async_decode_information(io.get_executor(),workers.get_executor(),dmi,
+//                                                               boost::asio::use_future)};
+//Entry point and table are read and decoded on worker executor, caller's io executor never blocks on it.
+//Handler runs on its associated executor, io executor by default, which keeps outstanding work until then.
+//Decoder is configured by caller before the call and must not be used by caller until completion.
+
+//decoded records, error code and table offset of first malformed structure
+typedef result<std::vector<std::pair<std::string,std::string>>> decode_result;
+typedef void decode_signature(decode_result);
+
+//handler bound to its result, posted to handler executor
+template<class Handler>
+struct decode_completion
+{
+    Handler handler_;
+    decode_result result_;
+
+    decode_completion(Handler&& handler, decode_result&& decoded)
+        :handler_{std::move(handler)},result_{std::move(decoded)}{
+    }
+    void operator()(){
+        handler_(std::move(result_));
+    }
+};
+
+//decode run on worker executor
+template<class Handler, class IoExecutor>
+struct decode_operation
+{
+    typedef typename boost::asio::associated_executor<Handler,IoExecutor>::type handler_executor;
+
+    Handler handler_;
+    std::shared_ptr<decoder> decoder_;
+    boost::asio::executor_work_guard<handler_executor> work_;
+
+    template<class CompletionHandler>
+    decode_operation(CompletionHandler&& handler, const std::shared_ptr<decoder>& dmi, const handler_executor& executor)
+        :handler_{std::forward<CompletionHandler>(handler)},decoder_{dmi},work_{executor}{
+    }
+    void operator()(){
+        decode_result decoded {decoder_->try_decode()};
+        const handler_executor& executor {work_.get_executor()};
+        boost::asio::post(executor,decode_completion<Handler> {std::move(handler_),std::move(decoded)});
+        work_.reset();
+    }
+};
+
+template<class IoExecutor, class WorkerExecutor>
+struct decode_initiation
+{
+    IoExecutor io_;
+    WorkerExecutor worker_;
+
+    template<class Handler>
+    void operator()(Handler&& handler, const std::shared_ptr<decoder>& dmi)const{
+        typedef typename std::decay<Handler>::type handler_type;
+        const auto& executor {boost::asio::get_associated_executor(handler,io_)};
+        boost::asio::post(worker_,decode_operation<handler_type,IoExecutor> {std::forward<Handler>(handler),dmi,executor});
+    }
+};
+
+//read and decode table of decoder on worker executor, completion token receives decode_result
+template<class IoExecutor, class WorkerExecutor, class CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, decode_signature)
+async_decode_information(const IoExecutor& io, const WorkerExecutor& worker, const std::shared_ptr<decoder>& dmi,
+                         CompletionToken&& token)
+{
+    return boost::asio::async_initiate<CompletionToken,decode_signature>(
+        decode_initiation<IoExecutor,WorkerExecutor> {io,worker},token,dmi);
+}
+
+#endif // ASYNC_H
@@ -0,0 +1,23 @@
+#include "cache.h"
+
+bool decode_cache::find(int type, std::uint64_t hash, int version, flags_format flags, boost::json::object &json)
+{
+    shard& current {shards_[hash % shards_count_]};
+    std::lock_guard<std::mutex> lock(current.mutex_);
+    const auto& found {current.objects_.find(key {type,hash,version,flags})};
+    if(found==current.objects_.end()){
+        ++misses_;
+        return false;
+    }
+    json=found->second;
+    ++hits_;
+    return true;
+}
+
+void decode_cache::insert(int type, std::uint64_t hash, int version, flags_format flags,
+                          const boost::json::object &json)
+{
+    shard& current {shards_[hash % shards_count_]};
+    std::lock_guard<std::mutex> lock(current.mutex_);
+    current.objects_.emplace(key {type,hash,version,flags},json);
+}
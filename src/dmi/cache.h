@@ -0,0 +1,68 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include "layout.h"
+#include <boost/json.hpp>
+
+//content-addressed cache of decoded structures, shared by decoders in batch mode
+class decode_cache
+{
+private:
+    //cache key: structure type, hash of formatted area, and table version and flags format
+    //the record was decoded with, as layouts gate fields by version
+    struct key
+    {
+        int type_ {};
+        std::uint64_t hash_ {};
+        int version_ {};
+        flags_format flags_ {};
+        key(int type, std::uint64_t hash, int version, flags_format flags)
+            :type_{type},hash_{hash},version_{version},flags_{flags}{
+        }
+        bool operator==(const key& other)const{
+            return type_==other.type_ && hash_==other.hash_ && version_==other.version_ && flags_==other.flags_;
+        }
+    };
+    struct key_hash
+    {
+        std::size_t operator()(const key& k)const{
+            return static_cast<std::size_t>(k.hash_ ^ (static_cast<std::uint64_t>(k.type_) << 56) ^
+                                            (static_cast<std::uint64_t>(k.version_) << 32) ^
+                                            (static_cast<std::uint64_t>(k.flags_) << 24));
+        }
+    };
+
+    //independent shards to keep lock contention low between worker threads
+    static const int shards_count_ {16};
+    struct shard
+    {
+        std::mutex mutex_ {};
+        std::unordered_map<key,boost::json::object,key_hash> objects_ {};
+    };
+    shard shards_[shards_count_];
+
+    std::atomic<unsigned long long> hits_ {0};
+    std::atomic<unsigned long long> misses_ {0};
+
+public:
+    explicit decode_cache()=default;
+    ~decode_cache()=default;
+    decode_cache(const decode_cache&)=delete;
+    decode_cache& operator=(const decode_cache&)=delete;
+
+    bool find(int type, std::uint64_t hash, int version, flags_format flags, boost::json::object& json);
+    void insert(int type, std::uint64_t hash, int version, flags_format flags, const boost::json::object& json);
+
+    inline unsigned long long hits()const{
+        return hits_.load();
+    }
+    inline unsigned long long misses()const{
+        return misses_.load();
+    }
+};
+
+#endif // CACHE_H
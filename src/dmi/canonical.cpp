@@ -0,0 +1,86 @@
+#include "canonical.h"
+#include "hash.h"
+
+#include <algorithm>
+#include <boost/format.hpp>
+
+namespace {
+boost::json::value canonical_value(const boost::json::value& json)
+{
+    if(json.is_object()){
+        return canonical_object(json.as_object());
+    }
+    if(json.is_array()){
+        boost::json::array out;
+        out.reserve(json.as_array().size());
+        for(const boost::json::value& item: json.as_array()){
+            out.push_back(canonical_value(item));
+        }
+        return out;
+    }
+    return json;
+}
+}
+
+boost::json::object canonical_object(const boost::json::object &json)
+{
+    std::vector<const boost::json::key_value_pair*> items;
+    items.reserve(json.size());
+    for(const boost::json::key_value_pair& item: json){
+        items.push_back(&item);
+    }
+    std::sort(items.begin(),items.end(),[](const boost::json::key_value_pair* left, const boost::json::key_value_pair* right){
+        return left->key() < right->key();
+    });
+
+    boost::json::object out;
+    out.reserve(items.size()+1);
+    for(const boost::json::key_value_pair* item: items){
+        out.emplace(item->key(),canonical_value(item->value()));
+    }
+    return out;
+}
+
+std::string digest_string(std::uint64_t digest)
+{
+    return (boost::format("%016x") % digest).str();
+}
+
+void canonicalize(std::vector<output_record> &records)
+{
+    //structure records by type and handle, other records after them in emitted order
+    std::stable_sort(records.begin(),records.end(),[](const output_record& left, const output_record& right){
+        if((left.type_<0)!=(right.type_<0)){
+            return right.type_<0;
+        }
+        if(left.type_!=right.type_){
+            return left.type_ < right.type_;
+        }
+        return left.handle_ < right.handle_;
+    });
+
+    //one record per structure handle
+    records.erase(std::unique(records.begin(),records.end(),[](const output_record& left, const output_record& right){
+                      return left.type_>=0 && left.type_==right.type_ && left.handle_==right.handle_;
+                  }),records.end());
+
+    //digest over serialized canonical record, table digest over record digests in output order
+    std::string table_digests {};
+    table_digests.reserve(records.size()*8);
+    for(output_record& record: records){
+        record.json_=canonical_object(record.json_);
+        const std::string& serialized {boost::json::serialize(record.json_)};
+        const std::uint64_t& digest {xxh64(serialized.data(),serialized.size())};
+        record.json_.emplace("digest",digest_string(digest));
+        for(int i=0;i<8;++i){
+            table_digests.push_back(static_cast<char>(digest >> (8*i)));
+        }
+    }
+
+    const boost::json::object& table_object {
+        {"digest", digest_string(xxh64(table_digests.data(),table_digests.size()))},
+        {"object_type", "table_digest"},
+        {"records", records.size()}
+    };
+    records.push_back(output_record {-1,-1,table_object});
+}
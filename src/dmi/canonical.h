@@ -0,0 +1,27 @@
+#ifndef CANONICAL_H
+#define CANONICAL_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <boost/json.hpp>
+
+//decoded object with type and handle of its structure, records not made from one structure have type -1
+struct output_record
+{
+    int type_;
+    int handle_;
+    boost::json::object json_;
+};
+
+//object with keys in byte order at every level, arrays keep element order
+boost::json::object canonical_object(const boost::json::object& json);
+
+//16 lower case hex digits of digest
+std::string digest_string(std::uint64_t digest);
+
+//canonical output: records sorted by type and handle, repeated handles dropped, keys ordered,
+//xxh64 "digest" of serialized record added to every record and table digest record appended
+void canonicalize(std::vector<output_record>& records);
+
+#endif // CANONICAL_H
@@ -0,0 +1,372 @@
+#include "columnar.h"
+
+#include <limits>
+#include <cstring>
+#include <fstream>
+#include <boost/filesystem.hpp>
+
+namespace {
+//little-endian integer of width bytes
+void write_le(std::string& out, std::uint64_t value, int width)
+{
+    for(int i=0;i<width;++i){
+        out.push_back(static_cast<char>((value >> (8*i)) & 0xFF));
+    }
+}
+
+std::uint64_t double_bits(double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits,&value,sizeof(bits));
+    return bits;
+}
+
+double bits_double(std::uint64_t bits)
+{
+    double value;
+    std::memcpy(&value,&bits,sizeof(value));
+    return value;
+}
+
+column_kind value_kind(const boost::json::value& value)
+{
+    if(value.is_int64()){
+        return column_kind::int64;
+    }
+    if(value.is_uint64()){
+        return column_kind::uint64;
+    }
+    if(value.is_double()){
+        return column_kind::float64;
+    }
+    if(value.is_bool()){
+        return column_kind::boolean;
+    }
+    return column_kind::string;
+}
+}
+
+column_kind column::common_kind(column_kind kind) const
+{
+    if(kind_==kind || kind_==column_kind::null){
+        return kind;
+    }
+    const bool& integer {kind_==column_kind::int64 || kind_==column_kind::uint64};
+    const bool& other_integer {kind==column_kind::int64 || kind==column_kind::uint64};
+    if(integer && other_integer){
+        //negative values do not fit unsigned column
+        if(kind_==column_kind::int64){
+            for(std::size_t row=0;row<rows_;++row){
+                if(valid_[row] && static_cast<std::int64_t>(numbers_[row]) < 0){
+                    return column_kind::string;
+                }
+            }
+        }
+        return column_kind::uint64;
+    }
+    if((integer || kind_==column_kind::float64) && (other_integer || kind==column_kind::float64)){
+        return column_kind::float64;
+    }
+    return column_kind::string;
+}
+
+std::string column::value_string(std::size_t row, const string_pool &pool) const
+{
+    switch(kind_){
+    case column_kind::null:
+        return std::string {};
+    case column_kind::int64:
+        return std::to_string(static_cast<std::int64_t>(numbers_[row]));
+    case column_kind::uint64:
+        return std::to_string(numbers_[row]);
+    case column_kind::float64:
+        return boost::json::serialize(boost::json::value(bits_double(numbers_[row])));
+    case column_kind::boolean:
+        return numbers_[row] ? "true" : "false";
+    case column_kind::string:
+        return pool.get(ids_[row]);
+    }
+    return std::string {};
+}
+
+void column::convert(column_kind kind, string_pool &pool)
+{
+    if(kind==kind_){
+        return;
+    }
+    if(kind==column_kind::string){
+        const std::uint32_t& empty {pool.intern(std::string {})};
+        std::vector<std::uint32_t> ids {};
+        ids.reserve(rows_);
+        for(std::size_t row=0;row<rows_;++row){
+            ids.push_back(valid_[row] ? pool.intern(value_string(row,pool)) : empty);
+        }
+        ids_.swap(ids);
+        numbers_.clear();
+    }
+    else if(kind_==column_kind::null){
+        numbers_.assign(rows_,0);
+    }
+    else if(kind==column_kind::float64){
+        for(std::size_t row=0;row<rows_;++row){
+            const double& value {kind_==column_kind::int64 ? static_cast<double>(static_cast<std::int64_t>(numbers_[row])) :
+                                                             static_cast<double>(numbers_[row])};
+            numbers_[row]=double_bits(value);
+        }
+    }
+    //int64 to uint64 keeps bits, column holds no negative values
+    kind_=kind;
+}
+
+void column::append(const boost::json::value &value, string_pool &pool)
+{
+    if(value.is_null()){
+        append_null();
+        return;
+    }
+    const column_kind& kind {value_kind(value)};
+    const bool& fits_unsigned {kind_==column_kind::uint64 && kind==column_kind::int64 && value.get_int64() >= 0};
+    if(kind!=kind_ && !fits_unsigned){
+        //negative value does not fit unsigned column
+        convert(kind_==column_kind::uint64 && kind==column_kind::int64 ? column_kind::string : common_kind(kind),pool);
+    }
+
+    switch(kind_){
+    case column_kind::null:
+        break;
+    case column_kind::int64:
+        numbers_.push_back(static_cast<std::uint64_t>(value.get_int64()));
+        break;
+    case column_kind::uint64:
+        numbers_.push_back(value.is_uint64() ? value.get_uint64() : static_cast<std::uint64_t>(value.get_int64()));
+        break;
+    case column_kind::float64:
+        numbers_.push_back(double_bits(value.is_double() ? value.get_double() :
+                                       value.is_int64() ? static_cast<double>(value.get_int64()) :
+                                                          static_cast<double>(value.get_uint64())));
+        break;
+    case column_kind::boolean:
+        numbers_.push_back(value.get_bool() ? 1 : 0);
+        break;
+    case column_kind::string:
+        ids_.push_back(value.is_string() ? pool.intern(value.get_string().data(),value.get_string().size()) :
+                                           pool.intern(boost::json::serialize(value)));
+        break;
+    }
+    valid_.push_back(1);
+    ++rows_;
+}
+
+void column::append_null()
+{
+    append_nulls(1);
+}
+
+void column::append_nulls(std::size_t count)
+{
+    if(kind_==column_kind::string){
+        //missing strings keep any id, validity bit marks them
+        ids_.insert(ids_.end(),count,0);
+    }
+    else if(kind_!=column_kind::null){
+        numbers_.insert(numbers_.end(),count,0);
+    }
+    valid_.insert(valid_.end(),count,0);
+    rows_+=count;
+}
+
+void column::append_column(const column &other, string_pool &pool, const string_pool &other_pool)
+{
+    if(other.kind_==column_kind::null){
+        append_nulls(other.rows_);
+        return;
+    }
+    if(other.kind_!=kind_){
+        column converted {other};
+        const column_kind& kind {common_kind(other.kind_)};
+        const column_kind& other_kind {converted.common_kind(kind)};
+        //both sides agree on kind, otherwise values are kept as strings
+        const column_kind& target {kind==other_kind ? kind : column_kind::string};
+        convert(target,pool);
+        converted.convert(target,pool);
+        //strings converted from other kinds are interned in this pool
+        append_column(converted,pool,other.kind_==column_kind::string ? other_pool : pool);
+        return;
+    }
+
+    if(kind_==column_kind::string){
+        if(&pool==&other_pool){
+            ids_.insert(ids_.end(),other.ids_.begin(),other.ids_.end());
+        }
+        else{
+            for(std::size_t row=0;row<other.rows_;++row){
+                ids_.push_back(other.valid_[row] ? pool.intern(other_pool.get(other.ids_[row])) : 0);
+            }
+        }
+    }
+    else{
+        numbers_.insert(numbers_.end(),other.numbers_.begin(),other.numbers_.end());
+    }
+    valid_.insert(valid_.end(),other.valid_.begin(),other.valid_.end());
+    rows_+=other.rows_;
+}
+
+void column::write(std::ostream &out, const string_pool &pool) const
+{
+    std::string buffer {};
+    buffer.push_back(static_cast<char>(kind_));
+
+    //validity bitmap
+    std::string bitmap((rows_+7)/8,'\0');
+    for(std::size_t row=0;row<rows_;++row){
+        if(valid_[row]){
+            bitmap[row/8]=static_cast<char>(bitmap[row/8] | (1 << (row%8)));
+        }
+    }
+    buffer+=bitmap;
+
+    switch(kind_){
+    case column_kind::null:
+        break;
+    case column_kind::int64:
+    case column_kind::uint64:
+    case column_kind::float64:
+        buffer.reserve(buffer.size()+numbers_.size()*8);
+        for(std::uint64_t value: numbers_){
+            write_le(buffer,value,8);
+        }
+        break;
+    case column_kind::boolean:
+        for(std::uint64_t value: numbers_){
+            buffer.push_back(static_cast<char>(value));
+        }
+        break;
+    case column_kind::string:{
+        //dictionary of strings used by column in first use order, pool ids are not written
+        std::unordered_map<std::uint32_t,std::uint32_t> dictionary {};
+        std::vector<std::uint32_t> indexes {};
+        indexes.reserve(rows_);
+        std::string offsets {};
+        std::string chars {};
+        write_le(offsets,0,8);
+        for(std::size_t row=0;row<rows_;++row){
+            if(!valid_[row]){
+                indexes.push_back(0);
+                continue;
+            }
+            const auto& inserted {dictionary.emplace(ids_[row],static_cast<std::uint32_t>(dictionary.size()))};
+            if(inserted.second){
+                chars+=pool.get(ids_[row]);
+                write_le(offsets,chars.size(),8);
+            }
+            indexes.push_back(inserted.first->second);
+        }
+        write_le(buffer,dictionary.size(),4);
+        buffer+=offsets;
+        buffer+=chars;
+        buffer.reserve(buffer.size()+indexes.size()*4);
+        for(std::uint32_t index: indexes){
+            write_le(buffer,index,4);
+        }
+        break;
+    }
+    }
+    out.write(buffer.data(),static_cast<std::streamsize>(buffer.size()));
+}
+
+column &column_table::find_column(const std::string &name)
+{
+    const auto& found {index_.find(name)};
+    if(found!=index_.end()){
+        return columns_[found->second];
+    }
+    index_.emplace(name,columns_.size());
+    names_.push_back(name);
+    columns_.push_back(column {});
+    columns_.back().append_nulls(rows_);
+    return columns_.back();
+}
+
+void column_table::append(std::int64_t host_id, const boost::json::object &json, string_pool &pool)
+{
+    columns_[0].append(boost::json::value(host_id),pool);
+    for(const boost::json::key_value_pair& item: json){
+        if(item.key()=="object_type"){
+            continue;
+        }
+        column& field {find_column(item.key())};
+        //repeated key in record keeps first value
+        if(field.rows()==rows_){
+            field.append(item.value(),pool);
+        }
+    }
+    ++rows_;
+
+    //fields missing in record
+    for(column& field: columns_){
+        if(field.rows() < rows_){
+            field.append_null();
+        }
+    }
+}
+
+void column_table::append_table(const column_table &other, string_pool &pool, const string_pool &other_pool)
+{
+    for(std::size_t i=0;i<other.columns_.size();++i){
+        find_column(other.names_[i]).append_column(other.columns_[i],pool,other_pool);
+    }
+    rows_+=other.rows_;
+    for(column& field: columns_){
+        if(field.rows() < rows_){
+            field.append_nulls(rows_-field.rows());
+        }
+    }
+}
+
+void column_table::write(std::ostream &out, const string_pool &pool) const
+{
+    std::string header {"DMICOL02"};
+    write_le(header,rows_,8);
+    write_le(header,columns_.size(),4);
+    out.write(header.data(),static_cast<std::streamsize>(header.size()));
+
+    for(std::size_t i=0;i<columns_.size();++i){
+        std::string name {};
+        const std::size_t length {std::min<std::size_t>(names_[i].size(),std::numeric_limits<std::uint16_t>::max())};
+        write_le(name,length,2);
+        name.append(names_[i],0,length);
+        out.write(name.data(),static_cast<std::streamsize>(name.size()));
+        columns_[i].write(out,pool);
+    }
+}
+
+void column_set::append(std::int64_t host_id, const boost::json::object &json)
+{
+    const boost::json::value* object_type {json.if_contains("object_type")};
+    if(object_type && object_type->is_string()){
+        tables_[object_type->get_string().c_str()].append(host_id,json,*pool_);
+    }
+}
+
+void column_set::append_set(const column_set &other)
+{
+    for(const std::pair<const std::string,column_table>& table: other.tables_){
+        tables_[table.first].append_table(table.second,*pool_,*other.pool_);
+    }
+}
+
+bool column_set::write(const std::string &directory, std::string &error) const
+{
+    for(const std::pair<const std::string,column_table>& table: tables_){
+        const boost::filesystem::path& path {boost::filesystem::path {directory} / (table.first+".dmicol")};
+        std::ofstream out {path.string(),std::ios::binary | std::ios::trunc};
+        if(out.is_open()){
+            table.second.write(out,*pool_);
+        }
+        if(!out.is_open() || !out.flush()){
+            error="Fail to write "+path.string();
+            return false;
+        }
+    }
+    return true;
+}
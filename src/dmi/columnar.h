@@ -0,0 +1,115 @@
+#ifndef COLUMNAR_H
+#define COLUMNAR_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <boost/json.hpp>
+#include "pool.h"
+
+//Columnar export of decoded records, one file per object type.
+//File layout, integers little-endian:
+//  magic "DMICOL02", u64 rows, u32 columns, then per column:
+//  u16 name length, name, u8 kind, validity bitmap of (rows+7)/8 bytes (bit set for present value),
+//  values: int64, uint64 and float64 as rows*8 bytes, boolean as rows bytes, null kind has no values,
+//  string dictionary encoded: u32 dictionary size, (size+1) u64 offsets, character data,
+//  then rows u32 dictionary indexes.
+//Missing values are written as 0 or dictionary index 0 with validity bit cleared.
+
+//value type of column, stored in file as one byte
+enum class column_kind : unsigned char
+{
+    //no value seen yet, all rows missing
+    null=0,
+    int64=1,
+    uint64=2,
+    float64=3,
+    boolean=4,
+    //strings, and values of mixed types, arrays and objects serialized as JSON, interned in string pool
+    string=5
+};
+
+//typed column builder
+class column
+{
+private:
+    column_kind kind_ {column_kind::null};
+    std::size_t rows_ {0};
+    std::vector<unsigned char> valid_ {};
+    //integer, float bits or boolean of each row
+    std::vector<std::uint64_t> numbers_ {};
+    //string pool id of each row
+    std::vector<std::uint32_t> ids_ {};
+
+    //change column type, existing values are kept or formatted as strings
+    void convert(column_kind kind, string_pool& pool);
+    //kind able to hold values of both kinds
+    column_kind common_kind(column_kind kind)const;
+    std::string value_string(std::size_t row, const string_pool& pool)const;
+
+public:
+    inline column_kind kind()const{
+        return kind_;
+    }
+    inline std::size_t rows()const{
+        return rows_;
+    }
+    void append(const boost::json::value& value, string_pool& pool);
+    void append_null();
+    void append_nulls(std::size_t count);
+    //add rows of other column, strings of other pool are interned again
+    void append_column(const column& other, string_pool& pool, const string_pool& other_pool);
+    void write(std::ostream& out, const string_pool& pool)const;
+};
+
+//rows of one object type, host_id is first column
+class column_table
+{
+private:
+    std::size_t rows_ {0};
+    std::vector<std::string> names_ {};
+    std::vector<column> columns_ {};
+    std::unordered_map<std::string,std::size_t> index_ {};
+
+    //column by name, new columns are filled with missing values up to current row
+    column& find_column(const std::string& name);
+
+public:
+    explicit column_table(){
+        find_column("host_id");
+    }
+    inline std::size_t rows()const{
+        return rows_;
+    }
+    //add decoded record, keys become columns, object_type is table name and not stored
+    void append(std::int64_t host_id, const boost::json::object& json, string_pool& pool);
+    //add rows of other table, columns are matched by name
+    void append_table(const column_table& other, string_pool& pool, const string_pool& other_pool);
+    void write(std::ostream& out, const string_pool& pool)const;
+};
+
+//tables of all object types decoded by one worker, sets of batch workers share one string pool
+class column_set
+{
+private:
+    std::map<std::string,column_table> tables_ {};
+    std::shared_ptr<string_pool> pool_ {};
+
+public:
+    explicit column_set(const std::shared_ptr<string_pool>& pool=std::make_shared<string_pool>())
+        :pool_{pool}{
+    }
+    void append(std::int64_t host_id, const boost::json::object& json);
+    void append_set(const column_set& other);
+    //write "<object_type>.dmicol" per table into existing directory, false and error on write failure
+    bool write(const std::string& directory, std::string& error)const;
+    inline const std::map<std::string,column_table>& tables()const{
+        return tables_;
+    }
+};
+
+#endif // COLUMNAR_H
@@ -1,17 +1,42 @@
 #ifndef DECODER_H
 #define DECODER_H
 
+#include <bitset>
 #include <vector>
 #include <string>
+#include <memory>
+#include <functional>
+#include <unordered_map>
 #include "entry.h"
+#include "load.h"
+#include "cache.h"
+#include "probe.h"
+#include "result.h"
+#include "raw.h"
+#include "layout.h"
+#include "canonical.h"
+#include "summary.h"
+#include "topology.h"
 #include "structure.h"
+#include "walker.h"
 #include <boost/json.hpp>
 #include <boost/property_tree/ptree.hpp>
 
+//receives object type and serialized json of each decoded record
+typedef std::function<void(const std::string& object_type, const std::string& json)> record_sink;
+//receives each decoded record before serialization
+typedef std::function<void(const boost::json::object& json)> object_sink;
+//record of one structure with its type and handle, as returned by next_record
+typedef output_record decoded_record;
+
 class decoder
 {
 private:
     std::string error_str_ {};
+    //error code and byte offset of error in table, message is kept in error_str_
+    decode_error error_code_ {decode_error::ok};
+    std::size_t error_offset_ {0};
+    void set_error(decode_error code, std::size_t offset, const std::string& message);
     //const std::string entry_path_ {"/home/yaroslav/dmi_tables/centos/smbios_entry_point"};
     //const std::string table_path_ {"/home/yaroslav/dmi_tables/centos/DMI"};
 
@@ -21,17 +46,65 @@ private:
 
     const std::string entry_path_ {"/sys/firmware/dmi/tables/smbios_entry_point"};
     const std::string table_path_ {"/sys/firmware/dmi/tables/DMI"};
+    //true if decoding captured tables instead of the running system
+    const bool captured_ {false};
     std::vector<std::string> anchors_ {};
     bool checksum(const std::vector<char> &data);
 
     entry t_point_;
     structure t_structure_;
     std::vector<structure> structure_list_ {};
+    //structures positions by handle, for resolving references between structures
+    std::unordered_map<int,std::size_t> handle_index_ {};
+    const structure* find_structure(int handle)const;
+    void index_structures();
     std::vector<std::pair<std::string,std::string>> dmi_list_{};
 
     bool decode_entry();
     std::vector<structure> decode_table();
+    //read table of running system or captured table file, checksum checked
+    bool read_table(std::vector<char>& content);
+    //split table into structures, stops at first malformed structure with error at its offset
+    std::vector<structure> parse_table(const char* table, std::size_t size);
+    std::vector<std::pair<std::string,std::string>> decode_structures();
+    std::size_t decode_structures(const record_sink& sink);
+    std::size_t decode_records(const object_sink& sink);
     boost::json::object decode_structure(const structure& dmi, int type);
+    //decoded or raw record of structure as set by raw mode, empty if structure has none
+    boost::json::object structure_record(const structure& dmi);
+
+    //table walked by next_structure and next_record, bytes are owned by decoder or by caller of open_table
+    std::vector<char> table_ {};
+    const char* cursor_table_ {nullptr};
+    std::size_t cursor_size_ {0};
+    table_walker walker_ {};
+
+    //json form of flags fields
+    flags_format flags_ {flags_format::names};
+
+    //raw records of structures and their encoding
+    raw_mode raw_ {raw_mode::none};
+    raw_encoding raw_encoding_ {raw_encoding::base64};
+
+    //records sorted by type and handle with ordered keys and digests
+    bool canonical_ {false};
+
+    //structure types decoded into records, all types if filter is empty
+    std::bitset<256> types_ {};
+
+    //append resolved cache topology to decoded structures
+    bool cache_topology_ {false};
+    std::vector<cache_topology> resolve_cache_topology()const;
+
+    //append resolved memory topology to decoded structures
+    bool memory_topology_ {false};
+    std::vector<memory_topology> resolve_memory_topology()const;
+
+    //shared decode cache for batch mode, records are keyed by table version and flags format too
+    std::shared_ptr<decode_cache> cache_ {};
+    boost::json::object decode_cached(const structure& dmi);
+    //replace string fields of cached record by those of structure
+    void resolve_strings(const structure& dmi, const type_layout& found, boost::json::object& json);
 
 public:
     explicit decoder(){
@@ -39,12 +112,108 @@ public:
         anchors_.push_back("_SM_");
         anchors_.push_back("_SM3_");
     };
+    //decode captured entry point and table files (batch mode)
+    explicit decoder(const std::string& entry_path, const std::string& table_path)
+        :entry_path_{entry_path},table_path_{table_path},captured_{true}{
+        anchors_.push_back("_SM_");
+        anchors_.push_back("_SM3_");
+    };
     ~decoder()=default;
     inline std::string error()const{
         return error_str_;
-    } 
+    }
+    inline decode_error error_code()const{
+        return error_code_;
+    }
+    inline std::size_t error_offset()const{
+        return error_offset_;
+    }
+    //smbios version of decoded table for field layouts, 0 if unknown
+    inline int version()const{
+        return smbios(t_point_.ep_major_version_,t_point_.ep_minor_version_);
+    }
+    inline void set_cache(const std::shared_ptr<decode_cache>& cache){
+        cache_=cache;
+    }
+    inline void set_flags_format(flags_format flags){
+        flags_=flags;
+    }
+    inline void set_raw_format(raw_mode mode, raw_encoding encoding){
+        raw_=mode;
+        raw_encoding_=encoding;
+    }
+    inline void set_canonical(bool enabled){
+        canonical_=enabled;
+    }
+    //decode only listed structure types, empty list decodes all types. Topology records are not filtered
+    inline void set_type_filter(const std::vector<int>& types){
+        types_.reset();
+        for(int type: types){
+            if(type >= 0 && type < static_cast<int>(types_.size())){
+                types_.set(static_cast<std::size_t>(type));
+            }
+        }
+    }
+    inline void set_cache_topology(bool enabled){
+        cache_topology_=enabled;
+    }
+    inline void set_memory_topology(bool enabled){
+        memory_topology_=enabled;
+    }
     std::vector<std::pair<std::string,std::string>> decode_information();
 
+    //decode table held in memory, version as stored in entry point
+    std::vector<std::pair<std::string,std::string>> decode_information(const char* table, std::size_t size,
+                                                                       int major_version, int minor_version);
+
+    //pass each record to sink as soon as it is decoded, records are not kept in decoder,
+    //canonical records reach sink after whole table is decoded and sorted. Returns records count
+    std::size_t decode_information(const record_sink& sink);
+    std::size_t decode_information(const char* table, std::size_t size, int major_version, int minor_version,
+                                   const record_sink& sink);
+
+    //pass each decoded record to sink without serializing it, e.g. for typed column builders
+    std::size_t decode_objects(const object_sink& sink);
+
+    //decode without exceptions: decoded structures, error code and table offset of first malformed structure
+    result<std::vector<std::pair<std::string,std::string>>> try_decode();
+    result<std::vector<std::pair<std::string,std::string>>> try_decode(const char* table, std::size_t size,
+                                                                       int major_version, int minor_version);
+
+    //pull-based reading: open table, then take structures or records one at a time, e.g. to stop at
+    //first type 1 record without reading rest of table. Nothing is kept for structures already passed.
+    //Canonical order and topology records need whole table and are not produced by next_record.
+    //Open table of running system or captured files, false and error on entry point or table failure
+    bool open_table();
+    //open table held in memory, table must outlive reading
+    bool open_table(const char* table, std::size_t size, int major_version, int minor_version);
+    //next structure of opened table, view points into table. False at table end or at malformed structure
+    //(error set, structures before it were returned)
+    bool next_structure(structure_view& view);
+    //next record of opened table, type filter, flags format, raw mode and decode cache apply
+    bool next_record(decoded_record& record);
+
+    //read raw structures without decoding them
+    const std::vector<structure>& read_structures();
+    const std::vector<structure>& read_structures(const char* table, std::size_t size,
+                                                  int major_version, int minor_version);
+
+    //memory, processor and slot totals in one walk over table, structures are not copied or decoded
+    summary decode_summary();
+
+    //probe values only, in one walk over table, structures are not copied
+    std::vector<probe> decode_probes();
+
+    //per socket caches, resolved through processor cache handles
+    std::vector<cache_topology> decode_cache_topology();
+
+    //per array populated slots and mapped address ranges, resolved through memory handles
+    std::vector<memory_topology> decode_memory_topology();
+
+    //fields of structure type decoded by field layout, nullptr for types with variable or cross-referenced
+    //content. Shared by full decode, query projection and decode cache
+    static const type_layout* find_layout(int type);
+
 private:
     //Type 0
     boost::json::object bios_information(const structure& dmi);
@@ -88,8 +257,11 @@ private:
     //Type 13
     boost::json::object bios_language_information(const structure& dmi);
 
-    //for decode additional structures with associations
-    void group_associations(const structure& dmi);
+    //Type 14
+    boost::json::object group_associations(const structure& dmi);
+
+    //Type 15
+    boost::json::object system_event_log(const structure& dmi);
 
     //Type 16
     boost::json::object physical_memory_array(const structure& dmi);
@@ -100,32 +272,80 @@ private:
     //Type 18
     boost::json::object memory_error_information(const structure& dmi);
 
+    //Type 19
+    boost::json::object memory_array_mapped_address(const structure& dmi);
+
+    //Type 20
+    boost::json::object memory_device_mapped_address(const structure& dmi);
+
     //Type 21
     boost::json::object builtin_pointing_device(const structure& dmi);
 
     //Type 22
     boost::json::object portable_battery(const structure& dmi);
 
-    //Type 26
-    boost::json::object voltage_probe(const structure& dmi);
+    //Type 23
+    boost::json::object system_reset(const structure& dmi);
+
+    //Type 24
+    boost::json::object hardware_security(const structure& dmi);
+
+    //Type 25
+    boost::json::object system_power_controls(const structure& dmi);
+
+    //read values of probe structures, types 26, 27, 28 and 29, from formatted area
+    static bool read_probe(int type, int handle, const field_view& view, probe& reading);
 
-    //Type 27
-    boost::json::object cooling_device(const structure& dmi);
+    //Types 26, 27, 28, 29 and 36
+    boost::json::object probe_information(const structure& dmi);
 
-    //Type 28
-    boost::json::object temperature_probe(const structure& dmi);
+    //Type 30
+    boost::json::object out_of_band_remote_access(const structure& dmi);
 
-    //Type 29
-    boost::json::object electrical_current_probe(const structure& dmi);
+    //Type 31
+    boost::json::object bis_entry_point(const structure& dmi);
+
+    //Type 32
+    boost::json::object system_boot_information(const structure& dmi);
+
+    //Type 33
+    boost::json::object memory_error_information_64(const structure& dmi);
 
     //Type 34
     boost::json::object management_device_information(const structure& dmi);
 
+    //Type 35
+    boost::json::object management_device_component(const structure& dmi);
+
+    //Type 37
+    boost::json::object memory_channel(const structure& dmi);
+
+    //Type 38
+    boost::json::object ipmi_device_information(const structure& dmi);
+
+    //Type 39
+    boost::json::object system_power_supply(const structure& dmi);
+
+    //Type 40, entries hold strings at variable offsets and are not cached
+    boost::json::object additional_information(const structure& dmi);
+
     //Type 41, Obsolete
     boost::json::object onboard_device_extended_information(const structure& dmi);
 
+    //Type 42
+    boost::json::object management_controller_host_interface(const structure& dmi);
+
+    //Type 43
+    boost::json::object tpm_device(const structure& dmi);
+
     //Type 44
     boost::json::object processor_additional_information(const structure& dmi);
+
+    //Type 45
+    boost::json::object firmware_inventory_information(const structure& dmi);
+
+    //Type 46
+    boost::json::object string_property(const structure& dmi);
 };
 
 #endif // DECODER_H
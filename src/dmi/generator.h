@@ -0,0 +1,131 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+//C++20 coroutine generators over pull-based reading of decoder (open_table, next_structure, next_record).
+//Available in C++20 translation units only, decoder library itself stays C++11, e.g.
+//  if(dmi.open_table()){
+//      for(const decoded_record& record: records(dmi)){
+//          if(record.type_==1){
+//              break;
+//          }
+//      }
+//  }
+#if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+
+#include <utility>
+#include <exception>
+#include <coroutine>
+#include "decoder.h"
+
+//lazy sequence of values yielded by coroutine, single pass
+template<class T>
+class generator
+{
+public:
+    struct promise_type
+    {
+        const T* value_ {nullptr};
+
+        generator get_return_object(){
+            return generator {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend()noexcept{
+            return {};
+        }
+        std::suspend_always final_suspend()noexcept{
+            return {};
+        }
+        //yielded value lives in coroutine frame until next resume
+        std::suspend_always yield_value(const T& value)noexcept{
+            value_=&value;
+            return {};
+        }
+        void return_void()noexcept{
+        }
+        //decoder reports failures through error codes, nothing is expected to throw
+        void unhandled_exception()noexcept{
+            std::terminate();
+        }
+    };
+
+    class iterator
+    {
+    private:
+        std::coroutine_handle<promise_type> handle_ {};
+
+    public:
+        explicit iterator(std::coroutine_handle<promise_type> handle)
+            :handle_{handle}{
+        }
+        inline const T& operator*()const{
+            return *handle_.promise().value_;
+        }
+        inline const T* operator->()const{
+            return handle_.promise().value_;
+        }
+        inline iterator& operator++(){
+            handle_.resume();
+            return *this;
+        }
+        inline bool operator==(std::default_sentinel_t)const{
+            return !handle_ || handle_.done();
+        }
+    };
+
+    explicit generator(std::coroutine_handle<promise_type> handle)
+        :handle_{handle}{
+    }
+    generator(generator&& other)noexcept
+        :handle_{std::exchange(other.handle_,{})}{
+    }
+    generator(const generator&)=delete;
+    generator& operator=(const generator&)=delete;
+    generator& operator=(generator&& other)noexcept{
+        if(this!=&other){
+            if(handle_){
+                handle_.destroy();
+            }
+            handle_=std::exchange(other.handle_,{});
+        }
+        return *this;
+    }
+    ~generator(){
+        if(handle_){
+            handle_.destroy();
+        }
+    }
+
+    //runs coroutine to first value
+    iterator begin(){
+        if(handle_){
+            handle_.resume();
+        }
+        return iterator {handle_};
+    }
+    std::default_sentinel_t end()const{
+        return {};
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_ {};
+};
+
+//raw structures of table opened by dmi.open_table, views point into table
+inline generator<structure_view> structures(decoder& dmi){
+    structure_view view {};
+    while(dmi.next_structure(view)){
+        co_yield view;
+    }
+}
+
+//decoded records of table opened by dmi.open_table, structures after early stop are not read
+inline generator<decoded_record> records(decoder& dmi){
+    decoded_record record {};
+    while(dmi.next_record(record)){
+        co_yield record;
+    }
+}
+
+#endif
+
+#endif // GENERATOR_H
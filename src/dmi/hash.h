@@ -0,0 +1,101 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include "load.h"
+
+//xxHash64 primes
+const std::uint64_t xxh_prime_1 {0x9E3779B185EBCA87ULL};
+const std::uint64_t xxh_prime_2 {0xC2B2AE3D27D4EB4FULL};
+const std::uint64_t xxh_prime_3 {0x165667B19E3779F9ULL};
+const std::uint64_t xxh_prime_4 {0x85EBCA77C2B2AE63ULL};
+const std::uint64_t xxh_prime_5 {0x27D4EB2F165667C5ULL};
+
+inline std::uint64_t xxh_rotl(std::uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline std::uint64_t xxh_read_64(const unsigned char* ptr)
+{
+    return load_le64(ptr);
+}
+
+inline std::uint32_t xxh_read_32(const unsigned char* ptr)
+{
+    return load_le32(ptr);
+}
+
+inline std::uint64_t xxh_round(std::uint64_t acc, std::uint64_t input)
+{
+    acc+=input * xxh_prime_2;
+    acc=xxh_rotl(acc,31);
+    return acc * xxh_prime_1;
+}
+
+inline std::uint64_t xxh_merge_round(std::uint64_t acc, std::uint64_t value)
+{
+    acc^=xxh_round(0,value);
+    return acc * xxh_prime_1 + xxh_prime_4;
+}
+
+//xxHash64 of data block, used as content address of structures
+inline std::uint64_t xxh64(const char* data, std::size_t size, std::uint64_t seed=0)
+{
+    const unsigned char* ptr {reinterpret_cast<const unsigned char*>(data)};
+    const unsigned char* end {ptr + size};
+    std::uint64_t hash {0};
+
+    if(size >= 32){
+        std::uint64_t v1 {seed + xxh_prime_1 + xxh_prime_2};
+        std::uint64_t v2 {seed + xxh_prime_2};
+        std::uint64_t v3 {seed};
+        std::uint64_t v4 {seed - xxh_prime_1};
+        const unsigned char* limit {end - 32};
+        do{
+            v1=xxh_round(v1,xxh_read_64(ptr));
+            v2=xxh_round(v2,xxh_read_64(ptr + 8));
+            v3=xxh_round(v3,xxh_read_64(ptr + 16));
+            v4=xxh_round(v4,xxh_read_64(ptr + 24));
+            ptr+=32;
+        }while(ptr <= limit);
+        hash=xxh_rotl(v1,1) + xxh_rotl(v2,7) + xxh_rotl(v3,12) + xxh_rotl(v4,18);
+        hash=xxh_merge_round(hash,v1);
+        hash=xxh_merge_round(hash,v2);
+        hash=xxh_merge_round(hash,v3);
+        hash=xxh_merge_round(hash,v4);
+    }
+    else{
+        hash=seed + xxh_prime_5;
+    }
+
+    hash+=static_cast<std::uint64_t>(size);
+
+    while(ptr + 8 <= end){
+        hash^=xxh_round(0,xxh_read_64(ptr));
+        hash=xxh_rotl(hash,27) * xxh_prime_1 + xxh_prime_4;
+        ptr+=8;
+    }
+    if(ptr + 4 <= end){
+        hash^=static_cast<std::uint64_t>(xxh_read_32(ptr)) * xxh_prime_1;
+        hash=xxh_rotl(hash,23) * xxh_prime_2 + xxh_prime_3;
+        ptr+=4;
+    }
+    while(ptr < end){
+        hash^=(*ptr) * xxh_prime_5;
+        hash=xxh_rotl(hash,11) * xxh_prime_1;
+        ++ptr;
+    }
+
+    //avalanche
+    hash^=hash >> 33;
+    hash*=xxh_prime_2;
+    hash^=hash >> 29;
+    hash*=xxh_prime_3;
+    hash^=hash >> 32;
+    return hash;
+}
+
+#endif // HASH_H
@@ -0,0 +1,226 @@
+#include "identity.h"
+#include "walker.h"
+#include "load.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+#include <windows.h>
+#include <sysinfoapi.h>
+#endif
+
+namespace {
+const char hex_lower[] {"0123456789abcdef"};
+
+//first version with system uuid field
+const int uuid_version {0x0201};
+
+//whitespace removed by boost::trim_copy of decoded records
+bool is_space(char item)
+{
+    return item==' ' || item=='\t' || item=='\n' || item=='\v' || item=='\f' || item=='\r';
+}
+
+//trimmed string of 1-based locator at field offset, cut to out_size-1 bytes
+void copy_string(const structure_view& view, int offset, char* out, std::size_t out_size)
+{
+    out[0]='\0';
+    if(offset >= view.length_){
+        return;
+    }
+    const int& locator {static_cast<unsigned char>(view.data_[offset])};
+    const char* item {view.strings_};
+    const char* end {view.strings_+view.strings_size_};
+    for(int i=1;i<locator && item<end;++i){
+        const char* item_end {static_cast<const char*>(std::memchr(item,'\0',end-item))};
+        item=item_end ? item_end+1 : end;
+    }
+    if(locator==0 || item>=end){
+        return;
+    }
+    const char* item_end {static_cast<const char*>(std::memchr(item,'\0',end-item))};
+    if(!item_end){
+        item_end=end;
+    }
+    while(item<item_end && is_space(*item)){
+        ++item;
+    }
+    while(item_end>item && is_space(item_end[-1])){
+        --item_end;
+    }
+    const std::size_t size {std::min<std::size_t>(static_cast<std::size_t>(item_end-item),out_size-1)};
+    std::memcpy(out,item,size);
+    out[size]='\0';
+}
+
+//16 bytes in memory order as 8-4-4-4-12 lower case hex digits, as boost::uuids::to_string
+void copy_uuid(const unsigned char* data, char* out)
+{
+    for(int i=0;i<16;++i){
+        if(i==4 || i==6 || i==8 || i==10){
+            *out++='-';
+        }
+        *out++=hex_lower[data[i] >> 4];
+        *out++=hex_lower[data[i] & 0x0F];
+    }
+    *out='\0';
+}
+
+//take fields of first type 1, 2 and 3 structures, true when walk can stop
+bool take_structure(const structure_view& view, int version, system_identity& identity)
+{
+    if(view.type_==1 && !identity.system_){
+        identity.system_=true;
+        copy_string(view,0x05,identity.product_name_,sizeof(identity.product_name_));
+        copy_string(view,0x07,identity.serial_number_,sizeof(identity.serial_number_));
+        if(view.length_ >= 0x08+16 && (version==0 || version >= uuid_version)){
+            copy_uuid(reinterpret_cast<const unsigned char*>(view.data_+0x08),identity.uuid_);
+        }
+    }
+    else if(view.type_==2 && !identity.baseboard_){
+        identity.baseboard_=true;
+        copy_string(view,0x07,identity.baseboard_serial_number_,sizeof(identity.baseboard_serial_number_));
+    }
+    else if(view.type_==3 && !identity.chassis_){
+        identity.chassis_=true;
+        copy_string(view,0x07,identity.chassis_serial_number_,sizeof(identity.chassis_serial_number_));
+    }
+    return (identity.system_ && identity.baseboard_ && identity.chassis_) || view.type_==127;
+}
+
+//smbios version of entry point file as major*0x100+minor
+decode_error read_version(const std::string& entry_path, int& version)
+{
+    unsigned char entry[32] {};
+    std::FILE* file {std::fopen(entry_path.c_str(),"rb")};
+    if(!file){
+        return decode_error::entry_unreadable;
+    }
+    const std::size_t& size {std::fread(entry,1,sizeof(entry),file)};
+    std::fclose(file);
+    if(size==0){
+        return decode_error::entry_unreadable;
+    }
+
+    //anchor, length and version offsets of 32-bit (_SM_) and 64-bit (_SM3_) entry points
+    const bool& sm3 {size>=5 && !std::memcmp(entry,"_SM3_",5)};
+    const bool& sm {!sm3 && size>=4 && !std::memcmp(entry,"_SM_",4)};
+    if(!sm && !sm3){
+        return decode_error::entry_anchor;
+    }
+    const field_view view {reinterpret_cast<const char*>(entry),size};
+    const std::size_t& length {view.u8(sm ? 0x05 : 0x06)};
+    if(!length || length > size){
+        return decode_error::entry_length;
+    }
+    version=sm ? view.u8(0x06)*0x100+view.u8(0x07) : view.u8(0x07)*0x100+view.u8(0x08);
+    return decode_error::ok;
+}
+}
+
+decode_error read_identity(const char *table, std::size_t size, int major_version, int minor_version,
+                           system_identity &identity)
+{
+    identity=system_identity {};
+    const int& version {major_version*0x100+minor_version};
+    table_walker walker {table,size};
+    structure_view view {};
+    while(walker.next(view)){
+        if(take_structure(view,version,identity)){
+            return decode_error::ok;
+        }
+    }
+    return walker.error_code();
+}
+
+decode_error read_identity(const std::string &entry_path, const std::string &table_path, system_identity &identity)
+{
+    identity=system_identity {};
+    int version {0};
+    const decode_error& entry_error {read_version(entry_path,version)};
+    if(entry_error!=decode_error::ok){
+        return entry_error;
+    }
+
+    std::FILE* file {std::fopen(table_path.c_str(),"rb")};
+    if(!file){
+        return decode_error::table_unreadable;
+    }
+
+    //structures are walked as chunks arrive, structure cut by chunk end is walked again after next read.
+    //Identity structures lead the table, usually first chunk holds them
+    char buffer[16384];
+    std::size_t used {0};
+    std::size_t total {0};
+    bool end_of_file {false};
+    decode_error error {decode_error::ok};
+    while(true){
+        if(!end_of_file){
+            const std::size_t& count {std::fread(buffer+used,1,sizeof(buffer)-used,file)};
+            used+=count;
+            total+=count;
+            if(used < sizeof(buffer)){
+                end_of_file=true;
+                if(std::ferror(file)){
+                    error=decode_error::table_unreadable;
+                    break;
+                }
+            }
+        }
+        if(total==0){
+            error=decode_error::table_unreadable;
+            break;
+        }
+
+        table_walker walker {buffer,used};
+        structure_view view {};
+        bool done {false};
+        while(!done && walker.next(view)){
+            done=take_structure(view,version,identity);
+        }
+        if(done){
+            break;
+        }
+
+        //structure running past buffer end is read again with next chunk, other errors are final
+        std::size_t consumed {used};
+        if(walker.error_code()!=decode_error::ok){
+            //structure at buffer start not fitting whole buffer is reported as malformed
+            const bool& cut {walker.error_code()!=decode_error::short_length &&
+                             !end_of_file && walker.error_offset() > 0};
+            if(!cut){
+                error=walker.error_code();
+                break;
+            }
+            consumed=walker.error_offset();
+        }
+        std::memmove(buffer,buffer+consumed,used-consumed);
+        used-=consumed;
+        if(end_of_file && used==0){
+            break;
+        }
+    }
+    std::fclose(file);
+    return error;
+}
+
+decode_error read_identity(system_identity &identity)
+{
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+    identity=system_identity {};
+    //raw SMBIOS data: calling method, major and minor version, revision, u32 length, table
+    const DWORD& size {GetSystemFirmwareTable('RSMB',0,NULL,0)};
+    std::vector<char> data(size);
+    if(size < 8 || GetSystemFirmwareTable('RSMB',0,data.data(),size)!=size){
+        return decode_error::table_unreadable;
+    }
+    const std::size_t length {std::min<std::size_t>(load_le32(data.data()+4),size-8)};
+    return read_identity(data.data()+8,length,static_cast<unsigned char>(data[1]),static_cast<unsigned char>(data[2]),
+                         identity);
+#else
+    return read_identity("/sys/firmware/dmi/tables/smbios_entry_point","/sys/firmware/dmi/tables/DMI",identity);
+#endif
+}
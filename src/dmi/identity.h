@@ -0,0 +1,46 @@
+#ifndef IDENTITY_H
+#define IDENTITY_H
+
+#include <string>
+#include <cstddef>
+#include "result.h"
+
+//"who am I" fields of system (type 1), baseboard (type 2) and chassis (type 3) structures in fixed buffers.
+//Values equal those of decoded records (trimmed strings, lower case uuid), strings longer than buffer are cut.
+//Missing structures or fields leave empty strings
+struct system_identity
+{
+    static const std::size_t string_size_ {65};
+
+    //type 1 "uuid", 8-4-4-4-12 hex digits
+    char uuid_[37] {};
+    //type 1 "serial_number"
+    char serial_number_[string_size_] {};
+    //type 1 "product_name"
+    char product_name_[string_size_] {};
+    //type 2 "serial_number"
+    char baseboard_serial_number_[string_size_] {};
+    //type 3 "serial_number"
+    char chassis_serial_number_[string_size_] {};
+
+    //structures found in table
+    bool system_ {false};
+    bool baseboard_ {false};
+    bool chassis_ {false};
+};
+
+//Fast path without decoder: walks table only up to first type 1, 2 and 3 structures,
+//no records, JSON or string vectors are built
+
+//identity from table held in memory, version as stored in entry point.
+//Returns error of malformed structure met before all three structures were found
+decode_error read_identity(const char* table, std::size_t size, int major_version, int minor_version,
+                           system_identity& identity);
+
+//identity of captured entry point and table files, table file is read in chunks until structures are found
+decode_error read_identity(const std::string& entry_path, const std::string& table_path, system_identity& identity);
+
+//identity of running system
+decode_error read_identity(system_identity& identity);
+
+#endif // IDENTITY_H
@@ -0,0 +1,124 @@
+#include "layout.h"
+#include "load.h"
+
+#include <string>
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+
+namespace {
+boost::json::value field_get(const structure& dmi, const field_layout& field, const unsigned char* data)
+{
+    switch(field.kind_){
+    case field_kind::integer:{
+        const unsigned long long& value {load_le(data,field.width_)};
+        if(field.width_ < 8){
+            return static_cast<long long>(value);
+        }
+        return value;
+    }
+    case field_kind::string:{
+        const int& locator {data[0]-1};
+        if((locator >= 0) && (dmi.strings_.size() > locator)){
+            return boost::json::string {boost::trim_copy(dmi.strings_[locator])};
+        }
+        return boost::json::string {};
+    }
+    case field_kind::enumeration:{
+        const unsigned long long& value {load_le(data,field.width_)};
+        const char* name {find_name(field.names_,field.mask_ ? (value & field.mask_) : value)};
+        return boost::json::string {name ? name : ""};
+    }
+    case field_kind::flags:{
+        std::string out {};
+        append_flags(out,load_le(data,field.width_) & (field.mask_ ? field.mask_ : ~0ULL),field.names_);
+        return boost::json::string {out};
+    }
+    case field_kind::custom:
+        return field.decode_(data);
+    }
+    return boost::json::value {};
+}
+
+//value of field missing in structure
+boost::json::value field_default(const field_layout& field)
+{
+    if(field.kind_==field_kind::integer){
+        return 0;
+    }
+    return boost::json::string {};
+}
+}
+
+void append_flags(std::string &out, unsigned long long value, const name_table &table)
+{
+    bool first {true};
+    expand_flags(value,table,[&out,&first](const char* name){
+        if(!first){
+            out+=", ";
+        }
+        out+=name;
+        first=false;
+    });
+}
+
+void emplace_flags(boost::json::object &json, const char *name, unsigned long long value,
+                   const name_table &table, flags_format flags)
+{
+    if(flags==flags_format::names){
+        std::string out {};
+        append_flags(out,value,table);
+        json.emplace(name, out);
+        return;
+    }
+    json.emplace(name, value);
+    if(flags==flags_format::raw_and_names){
+        boost::json::array names;
+        expand_flags(value,table,[&names](const char* item){
+            names.emplace_back(item);
+        });
+        json.emplace(std::string {name}+"_names", names);
+    }
+}
+
+const char *find_name(const name_table &table, unsigned long long key)
+{
+    const name_entry* end {table.entries_+table.size_};
+    const name_entry* found {std::lower_bound(table.entries_,end,key,[](const name_entry& entry, unsigned long long key){
+            return entry.key_ < key;
+        })};
+    return (found!=end && found->key_==key) ? entry_name(*found) : nullptr;
+}
+
+boost::json::value decode_field(const structure &dmi, const field_layout &field, int version)
+{
+    const field_view view {dmi.data_};
+    if(view.has(field.offset_,field.width_) && (version==0 || version >= field.version_)){
+        return field_get(dmi,field,view.data()+field.offset_);
+    }
+    return field_default(field);
+}
+
+boost::json::object decode_layout(const structure &dmi, const type_layout &layout, int version, flags_format flags)
+{
+    const field_view view {dmi.data_};
+
+    //one bounds check for structures holding every field, per field check for short ones
+    const bool complete {view.has(0,layout.length_)};
+
+    boost::json::object out_object;
+    out_object.reserve(layout.size_+3);
+    out_object.emplace("object_type", layout.object_type_);
+    for(std::size_t i=0;i<layout.size_;++i){
+        const field_layout& field {layout.fields_[i]};
+        const bool present {(complete || view.has(field.offset_,field.width_)) &&
+                            (version==0 || version >= field.version_)};
+        if(field.kind_==field_kind::flags && flags!=flags_format::names){
+            const unsigned long long& value {present ? (load_le(view.data()+field.offset_,field.width_) &
+                                                        (field.mask_ ? field.mask_ : ~0ULL)) : 0};
+            emplace_flags(out_object,field.name_,value,field.names_,flags);
+            continue;
+        }
+        out_object.emplace(field.name_, present ? field_get(dmi,field,view.data()+field.offset_) : field_default(field));
+    }
+    return out_object;
+}
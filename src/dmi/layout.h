@@ -0,0 +1,180 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include "structure.h"
+#include <boost/json.hpp>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//zero terminated names of all name tables, generated from names.spec (names.cpp)
+extern const char name_blob[];
+
+//enumeration value or flag bit name, name is offset in name_blob so tables need no relocations
+struct name_entry
+{
+    std::uint32_t key_;
+    std::uint32_t name_;
+};
+
+inline const char* entry_name(const name_entry& entry){
+    return name_blob+entry.name_;
+}
+
+//names of enumeration values (sorted by key) or flag bits
+struct name_table
+{
+    const name_entry* entries_;
+    std::size_t size_;
+};
+
+template<std::size_t N>
+constexpr name_table names(const name_entry (&entries)[N]){
+    return name_table {entries,N};
+}
+
+//find name of enumeration value, nullptr if not in table
+const char* find_name(const name_table& table, unsigned long long key);
+
+//index of lowest set bit, value must not be 0
+inline int ctz64(unsigned long long value){
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index,value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+//call sink with name of each set bit, flag tables hold single bit keys sorted ascending
+template<class Sink>
+void expand_flags(unsigned long long value, const name_table& table, Sink sink){
+    const name_entry* entry {table.entries_};
+    const name_entry* end {table.entries_+table.size_};
+    while(value && entry!=end){
+        const unsigned long long bit {1ULL << ctz64(value)};
+        value&=value-1;
+        //bits come in ascending order, search continues from previous name
+        entry=std::lower_bound(entry,end,bit,[](const name_entry& item, unsigned long long key){
+                return item.key_ < key;
+            });
+        if(entry!=end && entry->key_==bit){
+            sink(entry_name(*entry));
+        }
+    }
+}
+
+//append names of set bits to out, separated by ", "
+void append_flags(std::string& out, unsigned long long value, const name_table& table);
+
+//how field bytes are decoded
+enum class field_kind
+{
+    //little-endian unsigned value of 1, 2, 4 or 8 bytes
+    integer,
+    //string number, 1 byte
+    string,
+    //little-endian value looked up in names table
+    enumeration,
+    //little-endian bitmask, names of set bits joined
+    flags,
+    //value computed by decode function from field bytes
+    custom
+};
+
+//custom field decoder, data points to first byte of field
+typedef boost::json::value (*field_decoder)(const unsigned char* data);
+
+//field of structure formatted area
+struct field_layout
+{
+    //json key
+    const char* name_;
+    int offset_;
+    int width_;
+    field_kind kind_;
+    name_table names_;
+    //value bits used for enumeration and flags, 0 for all bits
+    unsigned long long mask_;
+    //first SMBIOS version defining field, 0 for all versions
+    int version_;
+    field_decoder decode_;
+};
+
+//SMBIOS version as used by field layouts
+constexpr int smbios(int major, int minor){
+    return major * 0x100 + minor;
+}
+
+constexpr field_layout string_field(const char* name, int offset, int version=0){
+    return field_layout {name,offset,1,field_kind::string,name_table {nullptr,0},0,version,nullptr};
+}
+
+constexpr field_layout integer_field(const char* name, int offset, int width, int version=0){
+    return field_layout {name,offset,width,field_kind::integer,name_table {nullptr,0},0,version,nullptr};
+}
+
+constexpr field_layout enum_field(const char* name, int offset, int width, name_table table,
+                                  int version=0, unsigned long long mask=0){
+    return field_layout {name,offset,width,field_kind::enumeration,table,mask,version,nullptr};
+}
+
+constexpr field_layout flags_field(const char* name, int offset, int width, name_table table,
+                                   int version=0, unsigned long long mask=0){
+    return field_layout {name,offset,width,field_kind::flags,table,mask,version,nullptr};
+}
+
+constexpr field_layout custom_field(const char* name, int offset, int width, field_decoder decode,
+                                    int version=0){
+    return field_layout {name,offset,width,field_kind::custom,name_table {nullptr,0},0,version,decode};
+}
+
+//formatted area length needed by all fields
+constexpr std::size_t layout_length(const field_layout* fields, std::size_t size){
+    return size==0 ? 0 :
+           (static_cast<std::size_t>(fields[0].offset_+fields[0].width_) > layout_length(fields+1,size-1) ?
+            static_cast<std::size_t>(fields[0].offset_+fields[0].width_) : layout_length(fields+1,size-1));
+}
+
+//fields of one structure type, in output order
+struct type_layout
+{
+    const char* object_type_;
+    const field_layout* fields_;
+    std::size_t size_;
+    std::size_t length_;
+};
+
+template<std::size_t N>
+constexpr type_layout layout(const char* object_type, const field_layout (&fields)[N]){
+    return type_layout {object_type,fields,N,layout_length(fields,N)};
+}
+
+//json form of flags fields
+enum class flags_format
+{
+    //names of set bits joined by ", "
+    names,
+    //raw integer only, names are expanded by consumer when needed
+    raw,
+    //raw integer plus array of names in "<field>_names"
+    raw_and_names
+};
+
+//add flags field to json in given format
+void emplace_flags(boost::json::object& json, const char* name, unsigned long long value,
+                   const name_table& table, flags_format flags);
+
+//value of one field as decode_layout sets it with flags as names, default if not present in structure or table version
+boost::json::value decode_field(const structure& dmi, const field_layout& field, int version);
+
+//decode structure by layout, fields not present in structure or table version get defaults
+boost::json::object decode_layout(const structure& dmi, const type_layout& layout, int version,
+                                  flags_format flags=flags_format::names);
+
+#endif // LAYOUT_H
@@ -0,0 +1,99 @@
+#ifndef LOAD_H
+#define LOAD_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//SMBIOS values are little-endian and not aligned, memcpy compiles to single loads
+inline std::uint16_t load_le16(const void* data){
+    std::uint16_t value;
+    std::memcpy(&value,data,sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__==__ORDER_BIG_ENDIAN__)
+    value=__builtin_bswap16(value);
+#endif
+    return value;
+}
+
+inline std::uint32_t load_le32(const void* data){
+    std::uint32_t value;
+    std::memcpy(&value,data,sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__==__ORDER_BIG_ENDIAN__)
+    value=__builtin_bswap32(value);
+#endif
+    return value;
+}
+
+inline std::uint64_t load_le64(const void* data){
+    std::uint64_t value;
+    std::memcpy(&value,data,sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__==__ORDER_BIG_ENDIAN__)
+    value=__builtin_bswap64(value);
+#endif
+    return value;
+}
+
+//little-endian value of 1, 2, 4 or 8 bytes
+inline std::uint64_t load_le(const void* data, int width){
+    switch(width){
+    case 1:
+        return *static_cast<const unsigned char*>(data);
+    case 2:
+        return load_le16(data);
+    case 4:
+        return load_le32(data);
+    case 8:
+        return load_le64(data);
+    }
+    //odd widths, assembled byte by byte
+    const unsigned char* bytes {static_cast<const unsigned char*>(data)};
+    std::uint64_t value {0};
+    for(int i=width-1;i>=0;--i){
+        value=(value << 8) | bytes[i];
+    }
+    return value;
+}
+
+//read-only view over structure bytes, fields outside of view read as missing value
+class field_view
+{
+private:
+    const unsigned char* data_ {nullptr};
+    std::size_t size_ {0};
+
+public:
+    explicit field_view(const std::vector<char>& data)
+        :data_{reinterpret_cast<const unsigned char*>(data.data())},size_{data.size()}{
+    }
+    explicit field_view(const char* data, std::size_t size)
+        :data_{reinterpret_cast<const unsigned char*>(data)},size_{size}{
+    }
+
+    inline std::size_t size()const{
+        return size_;
+    }
+    inline const unsigned char* data()const{
+        return data_;
+    }
+
+    //true if width bytes from offset are inside view, check once for whole structure
+    inline bool has(std::size_t offset, std::size_t width=1)const{
+        return offset+width<=size_;
+    }
+
+    inline std::uint8_t u8(std::size_t offset, std::uint8_t missing=0)const{
+        return has(offset,1) ? data_[offset] : missing;
+    }
+    inline std::uint16_t u16(std::size_t offset, std::uint16_t missing=0)const{
+        return has(offset,2) ? load_le16(data_+offset) : missing;
+    }
+    inline std::uint32_t u32(std::size_t offset, std::uint32_t missing=0)const{
+        return has(offset,4) ? load_le32(data_+offset) : missing;
+    }
+    inline std::uint64_t u64(std::size_t offset, std::uint64_t missing=0)const{
+        return has(offset,8) ? load_le64(data_+offset) : missing;
+    }
+};
+
+#endif // LOAD_H
@@ -0,0 +1,1325 @@
+# Names of SMBIOS enumeration values and flag bits used by decoder.
+# Compiled by tools/namegen into names.h and names.cpp at build time: one read-only
+# blob holds every distinct name once, tables hold key and blob offset pairs.
+#
+# [table_name] description
+# <key> <name>
+# Keys are decimal or 0x hexadecimal and ascend in each table, flag tables have single bit keys.
+# Name is rest of line, names that are empty or have leading or trailing spaces are quoted.
+
+[bios_characteristics_names] bios characteristics flags, low 4 bytes
+0x00000001 Reserved
+0x00000002 Reserved
+0x00000004 Unknown
+0x00000008 BIOS Characteristics are not supported
+0x00000010 ISA is supported
+0x00000020 MCA is supported
+0x00000040 EISA is supported
+0x00000080 PCI is supported
+0x00000100 PC card (PCMCIA) is supported
+0x00000200 Plug and Play is supported
+0x00000400 APM is supported
+0x00000800 BIOS is upgradeable (Flash)
+0x00001000 BIOS shadowing is allowed
+0x00002000 VL-VESA is supported
+0x00004000 ESCD support is available
+0x00008000 Boot from CD is supported
+0x00010000 Selectable boot is supported
+0x00020000 BIOS ROM is socketed (e.g. PLCC or SOP socket)
+0x00040000 Boot from PC card (PCMCIA) is supported
+0x00080000 EDD specification is supported
+0x00100000 Int 13h-Japanese floppy for NEC 9800 1.2 MB (3.5”, 1K bytes/sector, 360 RPM) is supported
+0x00200000 Int 13h-Japanese floppy for Toshiba 1.2 MB (3.5”, 360 RPM) is supported
+0x00400000 Int 13h-5.25” / 360 KB floppy services are supported
+0x00800000 Int 13h-5.25” /1.2 MB floppy services are supported
+0x01000000 Int 13h-3.5” / 720 KB floppy services are supported
+0x02000000 Int 13h-3.5” / 2.88 MB floppy services are supported
+0x04000000 Int 5h print screen Service is supported
+0x08000000 Int 9h 8042 keyboard services are supported
+0x10000000 Int 14h serial services are supported
+0x20000000 Int 17h printer services are supported
+0x40000000 Int 10h CGA/Mono Video Services are supported
+0x80000000 NEC PC-98
+
+[bios_ext_characteristics_names] bios characteristics extension byte 1 flags
+0x01 ACPI is supported
+0x02 USB Legacy is supported
+0x04 AGP is supported
+0x08 I2O boot is supported
+0x10 LS-120 SuperDisk boot is supported
+0x20 ATAPI ZIP drive boot is supported
+0x40 1394 boot is supported
+0x80 Smart battery is supported
+
+[wakeup_names] system wakeup type
+0x00 Reserved
+0x01 Other
+0x02 Unknown
+0x03 APM Timer
+0x04 Modem Ring
+0x05 LAN Remote
+0x06 Power Switch
+0x07 PCI PME#
+0x08 AC Power Restored
+
+[baseboard_feature_names] baseboard feature flags
+0x01 Hosting board
+0x02 Daughter required
+0x04 Removable
+0x08 Replaceable
+0x10 Hot swappable
+
+[board_type_names] board type
+0x01 Unknown
+0x02 Other
+0x03 Server Blade
+0x04 Connectivity Switch
+0x05 System Management Module
+0x06 Processor Module
+0x07 I/O Module
+0x08 Memory Module
+0x09 Daughter board
+0x0A Motherboard
+0x0B Processor/Memory Module
+0x0C Processor/IO Module
+0x0D Interconnect board
+
+[chassis_type_names] chassis type, bit 7 is chassis lock
+0x01 Other
+0x02 Unknown
+0x03 Desktop
+0x04 Low Profile Desktop
+0x05 Pizza Box
+0x06 Mini Tower
+0x07 Tower
+0x08 Portable
+0x09 Laptop
+0x0A Notebook
+0x0B Hand Held
+0x0C Docking Station
+0x0D All in One
+0x0E Sub Notebook
+0x0F Space-saving
+0x10 Lunch Box
+0x11 Main Server Chassis
+0x12 Expansion Chassis
+0x13 " SubChassis"
+0x14 Bus Expansion Chassis
+0x15 Peripheral Chassis
+0x16 RAID Chassis
+0x17 Rack Mount Chassis
+0x18 Sealed-case PC
+0x19 Multi-system chassis
+0x1A Compact PCI
+0x1B Advanced TCA
+0x1C Blade
+0x1D Blade Enclosure
+0x1E Tablet
+0x1F Convertible
+0x20 Detachable
+0x21 IoT Gateway
+0x22 Embedded PC
+0x23 Mini PC
+0x24 Stick PC
+
+[chassis_state_names] chassis state
+0x01 Other
+0x02 Unknown
+0x03 Safe
+0x04 Warning
+0x05 Critical
+0x06 Non-recoverable
+
+[security_status_names] chassis security status
+0x01 Other
+0x02 Unknown
+0x03 None
+0x04 External interface locked out
+0x05 External interface enabled
+
+[processor_type_names] processor type
+0x01 Other
+0x02 Unknown
+0x03 Central Processor
+0x04 Math Processor
+0x05 DSP Processor
+0x06 Video Processor
+
+[processor_voltage_names] processor legacy voltage flags
+0x01 5v
+0x02 3.3v
+0x04 2.9v
+
+[processor_upgrade_names] processor upgrade
+0x01 Other
+0x02 Unknown
+0x03 Daughter Board
+0x04 ZIF Socket
+0x05 Replaceable Piggy Back
+0x06 None
+0x07 LIF Socket
+0x08 Slot 1
+0x09 Slot 2
+0x0A 370-pin socket
+0x0B Slot A
+0x0C Slot M
+0x0D Socket 423
+0x0E Socket A (Socket 462)
+0x0F Socket 478
+0x10 Socket 754
+0x11 Socket 940
+0x12 Socket 939
+0x13 Socket mPGA604
+0x14 Socket LGA771
+0x15 Socket LGA775
+0x16 Socket S1
+0x17 Socket AM2
+0x18 Socket F (1207)
+0x19 Socket LGA1366
+0x1A Socket G34
+0x1B Socket AM3
+0x1C Socket C32
+0x1D Socket LGA1156
+0x1E Socket LGA1556
+0x1F Socket PGA988A
+0x20 Socket BGA1288
+0x21 Socket rPGA988B
+0x22 Socket BGA1023
+0x23 Socket BGA1224
+0x24 Socket LGA1155
+0x25 Socket LGA1356
+0x26 Socket LGA2011
+0x27 Socket FS1
+0x28 Socket FS2
+0x29 Socket FM1
+0x2A Socket FM2
+0x2B Socket LGA2011-3
+0x2C Socket LGA1356-3
+0x2D Socket LGA1150
+0x2E Socket BGA1168
+0x2F Socket BGA1234
+0x30 Socket BGA1234
+0x31 Socket AM4
+0x32 Socket LGA1151
+0x33 Socket LGA1151
+0x34 Socket BGA1440
+0x35 Socket BGA1515
+0x36 Socket LGA3647-1
+0x37 Socket SP3
+0x38 Socket SP3r2
+0x39 Socket LGA2066
+0x3A Socket BGA1392
+0x3B Socket BGA1510
+0x3C Socket BGA1528
+0x3D Socket LGA4189
+0x3E Socket LGA1200
+0x3F Socket LGA4677
+0x40 Socket LGA1700
+0x41 Socket BGA1744
+0x42 Socket BGA1781
+0x43 Socket BGA1211
+0x44 Socket BGA2422
+0x45 Socket LGA1211
+0x46 Socket LGA2422
+0x47 Socket LGA5773
+0x48 Socket BGA5773
+
+[processor_family_names] processor family
+0x01 Other
+0x02 Unknown
+0x03 8086
+0x04 80286
+0x05 Intel386™ processor
+0x06 ntel486™ processor
+0x07 8087
+0x08 80287
+0x09 80387
+0x0A 8487
+0x0B Intel® Pentium® processor
+0x0C Pentium® Pro processor
+0x0D Pentium® II processor
+0x0E Pentium® processor with MMX™ technology
+0x0F Intel® Celeron® processor
+0x10 Pentium® II Xeon™ processor
+0x11 Pentium® III processor
+0x12 M1 Family
+0x13 M2 Family
+0x14 Intel® Celeron® M processor
+0x15 Intel® Pentium® 4 HT processor
+0x16 Not assignment
+0x17 Not assignment
+0x18 "AMD Duron™ Processor Family "
+0x19 K5 Family
+0x1A K6 Family
+0x1B K6-2
+0x1C K6-3
+0x1D "AMD Athlon™ Processor Family "
+0x1E AMD29000 Family
+0x1F K6-2+
+0x20 Power PC Family
+0x21 Power PC 601
+0x22 Power PC 603
+0x23 Power PC 603+
+0x24 Power PC 604
+0x25 Power PC 620
+0x26 Power PC x704
+0x27 Power PC 750
+0x28 Intel® Core™ Duo processor
+0x29 Intel® Core™ Duo mobile processor
+0x2A Intel® Core™ Solo mobile processor
+0x2B Intel® Atom™ processor
+0x2C Intel® Core™ M processor
+0x2D Intel(R) Core(TM) m3 processor
+0x2E Intel(R) Core(TM) m5 processor
+0x2F Intel(R) Core(TM) m7 processor
+0x30 "Alpha Family "
+0x31 Alpha 21064
+0x32 Alpha 21066
+0x33 Alpha 21164
+0x34 Alpha 21164PC
+0x35 Alpha 21164a
+0x36 Alpha 21264
+0x37 Alpha 21364
+0x38 AMD Turion™ II Ultra Dual-Core Mobile M Processor Family
+0x39 AMD Turion™ II Dual-Core Mobile M Processor Family
+0x3A AMD Athlon™ II Dual-Core M Processor Family
+0x3B AMD Opteron™ 6100 Series Processor
+0x3C AMD Opteron™ 4100 Series Processor
+0x3D AMD Opteron™ 6200 Series Processor
+0x3E AMD Opteron™ 4200 Series Processor
+0x3F AMD FX™ Series Processor
+0x40 MIPS Family
+0x41 MIPS R4000
+0x42 MIPS R4200
+0x43 MIPS R4400
+0x44 MIPS R4600
+0x45 MIPS R10000
+0x46 AMD C-Series Processor
+0x47 AMD E-Series Processor
+0x48 AMD A-Series Processor
+0x49 AMD G-Series Processor
+0x4A AMD Z-Series Processor
+0x4B AMD R-Series Processor
+0x4C AMD Opteron™ 4300 Series Processor
+0x4D AMD Opteron™ 6300 Series Processor
+0x4E AMD Opteron™ 3300 Series Processor
+0x4F AMD FirePro™ Series Processor
+0x50 SPARC Family
+0x51 SuperSPARC
+0x52 microSPARC II
+0x53 microSPARC IIep
+0x54 UltraSPARC
+0x55 UltraSPARC II
+0x56 UltraSPARC Iii
+0x57 UltraSPARC III
+0x58 UltraSPARC IIIi
+0x60 68040 Family
+0x61 68xxx
+0x62 68000
+0x63 68010
+0x64 68020
+0x65 68030
+0x66 AMD Athlon(TM) X4 Quad-Core Processor Family
+0x67 AMD Opteron(TM) X1000 Series Processor
+0x68 AMD Opteron(TM) X2000 Series APU
+0x69 AMD Opteron(TM) A-Series Processor
+0x6A AMD Opteron(TM) X3000 Series APU
+0x6B AMD Zen Processor Family
+0x70 Hobbit Family
+0x78 Crusoe™ TM5000 Family
+0x79 Crusoe™ TM3000 Family
+0x7A Efficeon™ TM8000 Family
+0x80 Weitek
+0x81 Unknown
+0x82 Itanium™ processor
+0x83 AMD Athlon™ 64 Processor Family
+0x84 AMD Opteron™ Processor Family
+0x85 AMD Sempron™ Processor Family
+0x86 AMD Turion™ 64 Mobile Technology
+0x87 Dual-Core AMD Opteron™ Processor Family
+0x88 AMD Athlon™ 64 X2 Dual-Core Processor Family
+0x89 AMD Turion™ 64 X2 Mobile Technology
+0x8A Quad-Core AMD Opteron™ Processor Family
+0x8B Third-Generation AMD Opteron™ Processor Family
+0x8C AMD Phenom™ FX Quad-Core Processor Family
+0x8D AMD Phenom™ X4 Quad-Core Processor Family
+0x8E AMD Phenom™ X2 Dual-Core Processor Family
+0x8F AMD Athlon™ X2 Dual-Core Processor Family
+0x90 PA-RISC Family
+0x91 PA-RISC 8500
+0x92 PA-RISC 8000
+0x93 PA-RISC 7300LC
+0x94 PA-RISC 7200
+0x95 PA-RISC 7100LC
+0x96 PA-RISC 7100
+0xA0 V30 Family
+0xA1 Quad-Core Intel® Xeon® processor 3200 Series
+0xA2 Dual-Core Intel® Xeon® processor 3000 Series
+0xA3 Quad-Core Intel® Xeon® processor 5300 Series
+0xA4 Dual-Core Intel® Xeon® processor 5100 Series
+0xA5 Dual-Core Intel® Xeon® processor 5000 Series
+0xA6 Dual-Core Intel® Xeon® processor LV
+0xA7 Dual-Core Intel® Xeon® processor ULV
+0xA8 Dual-Core Intel® Xeon® processor 7100 Series
+0xA9 Quad-Core Intel® Xeon® processor 5400 Series
+0xAA Quad-Core Intel® Xeon® processor
+0xAB Dual-Core Intel® Xeon® processor 5200 Series
+0xAC Dual-Core Intel® Xeon® processor 7200 Series
+0xAD Quad-Core Intel® Xeon® processor 7300 Series
+0xAE Quad-Core Intel® Xeon® processor 7400 Series
+0xAF Multi-Core Intel® Xeon® processor 7400 Series
+0xB0 Pentium® III Xeon™ processor
+0xB1 Pentium® III Processor with Intel® SpeedStep™ Technology
+0xB2 Pentium® 4 Processor
+0xB3 Intel® Xeon® processor
+0xB4 AS400 Family
+0xB5 ntel® Xeon™ processor MP
+0xB6 AMD Athlon™ XP Processor Family
+0xB7 AMD Athlon™ MP Processor Family
+0xB8 Intel® Itanium® 2 processor
+0xB9 Intel® Pentium® M processor
+0xBA Intel® Celeron® D processor
+0xBB Intel® Pentium® D processor
+0xBC Intel® Pentium® Processor Extreme Edition
+0xBD Intel® Core™ Solo Processor
+0xBF Intel® Core™ 2 Duo Processor
+0xC0 Intel® Core™ 2 Solo processor
+0xC1 Intel® Core™ 2 Extreme processor
+0xC2 Intel® Core™ 2 Quad processor
+0xC3 Intel® Core™ 2 Extreme mobile processor
+0xC4 Intel® Core™ 2 Duo mobile processor
+0xC5 Intel® Core™ 2 Solo mobile processor
+0xC6 Intel® Core™ i7 processor
+0xC7 Dual-Core Intel® Celeron® processor
+0xC8 IBM390 Family
+0xC9 G4
+0xCA G5
+0xCB ESA/390 G6
+0xCC z/Architecture base
+0xCD Intel® Core™ i5 processor
+0xCE Intel® Core™ i3 processor
+0xCF Intel® Core™ i9 processor
+0xD2 VIA C7™-M Processor Family
+0xD3 VIA C7™-D Processor Family
+0xD4 VIA C7™ Processor Family
+0xD5 VIA Eden™ Processor Family
+0xD6 Multi-Core Intel® Xeon® processor
+0xD7 Dual-Core Intel® Xeon® processor 3xxx Series
+0xD8 Quad-Core Intel® Xeon® processor 3xxx Series
+0xD9 VIA Nano™ Processor Family
+0xDA Dual-Core Intel® Xeon® processor 5xxx Serie
+0xDB Quad-Core Intel® Xeon® processor 5xxx Series
+0xDD Dual-Core Intel® Xeon® processor 7xxx Series
+0xDE Quad-Core Intel® Xeon® processor 7xxx Serie
+0xDF Multi-Core Intel® Xeon® processor 7xxx Serie
+0xE0 Multi-Core Intel® Xeon® processor 3400 Series
+0xE4 AMD Opteron™ 3000 Series Processor
+0xE5 AMD Sempron™ II Processor
+0xE6 Embedded AMD Opteron™ Quad-Core Processor Family
+0xE7 AMD Phenom™ Triple-Core Processor Family
+0xE8 AMD Turion™ Ultra Dual-Core Mobile Processor Famil
+0xE9 AMD Turion™ Dual-Core Mobile Processor Family
+0xEA AMD Athlon™ Dual-Core Processor Family
+0xEB AMD Sempron™ SI Processor Family
+0xEC AMD Phenom™ II Processor Family
+0xED AMD Athlon™ II Processor Family
+0xEE Six-Core AMD Opteron™ Processor Family
+0xEF AMD Sempron™ M Processor Family
+0xFA i860
+0xFB ""
+0xFE i960
+
+[processor_family_2_names] processor family 2, values above 0xFF
+0x0100 ARMv7
+0x0101 ARMv8
+0x0102 ARMv9
+0x0103 Reserved for future use by ARM
+0x0104 SH-3
+0x0105 SH-4
+0x0118 ARM
+0x0119 StrongARM
+0x012C 6x86
+0x012D MediaGX
+0x012E MII
+0x0140 WinChip
+0x015E DSP
+0x01F4 Video Processor
+0x0200 RISC-V RV32
+0x0201 RISC-V RV64
+0x0202 RISC-V RV128
+0x0258 LoongArch
+0x0259 Loongson™ 1 Processor Family
+0x025A Loongson™ 2 Processor Family
+0x025B Loongson™ 3 Processor Family
+0x025C Loongson™ 2K Processor Family
+0x025D Loongson™ 3A Processor Family
+0x025E Loongson™ 3B Processor Family
+0x025F Loongson™ 3C Processor Family
+0x0260 Loongson™ 3D Processor Family
+0x0261 Loongson™ 3E Processor Family
+0x0262 Dual-Core Loongson™ 2K Processor 2xxx Series
+0x026C Quad-Core Loongson™ 3A Processor 5xxx Series
+0x026D Multi-Core Loongson™ 3A Processor 5xxx Series
+0x026E Quad-Core Loongson™ 3B Processor 5xxx Series
+0x026F Multi-Core Loongson™ 3B Processor 5xxx Series
+0x0270 Multi-Core Loongson™ 3C Processor 5xxx Series
+0x0271 Multi-Core Loongson™ 3D Processor 5xxx Series
+
+[processor_characteristics_names] processor characteristics flags
+0x0000 Reserved
+0x0002 Unknown
+0x0004 64-bit Capable
+0x0008 Multi-Core
+0x0010 Hardware Thread
+0x0020 Execute Protection
+0x0040 Enhanced Virtualization
+0x0080 Power/Performance Control
+0x0100 128-bit Capable
+0x0200 Arm64 SoC ID
+
+[processor_status_names] processor status, bits 2:0 of status byte
+0x00 Unknown
+0x01 CPU Enabled
+0x02 CPU Disabled by User
+0x03 CPU Disabled by BIOS (POST Error)
+0x04 CPU is Idle
+0x05 Reserved
+0x06 Reserved
+0x07 Other
+
+[processor_populated_names] socket populated, bit 6 of status byte
+0x00 CPU Socket Unpopulated
+0x40 CPU Socket Populated
+
+[x86_feature_names] x86 feature flags of processor id EDX word, as reported by CPUID leaf 1
+0x00000001 FPU (Floating-point unit on-chip)
+0x00000002 VME (Virtual mode extension)
+0x00000004 DE (Debugging extension)
+0x00000008 PSE (Page size extension)
+0x00000010 TSC (Time stamp counter)
+0x00000020 MSR (Model specific registers)
+0x00000040 PAE (Physical address extension)
+0x00000080 MCE (Machine check exception)
+0x00000100 CX8 (CMPXCHG8 instruction supported)
+0x00000200 APIC (On-chip APIC hardware supported)
+0x00000800 SEP (Fast system call)
+0x00001000 MTRR (Memory type range registers)
+0x00002000 PGE (Page global enable)
+0x00004000 MCA (Machine check architecture)
+0x00008000 CMOV (Conditional move instruction supported)
+0x00010000 PAT (Page attribute table)
+0x00020000 PSE-36 (36-bit page size extension)
+0x00040000 PSN (Processor serial number present and enabled)
+0x00080000 CLFSH (CLFLUSH instruction supported)
+0x00200000 DS (Debug store)
+0x00400000 ACPI (ACPI supported)
+0x00800000 MMX (MMX technology supported)
+0x01000000 FXSR (FXSAVE and FXSTOR instructions supported)
+0x02000000 SSE (Streaming SIMD extensions)
+0x04000000 SSE2 (Streaming SIMD extensions 2)
+0x08000000 SS (Self-snoop)
+0x10000000 HTT (Multi-threading)
+0x20000000 TM (Thermal monitor supported)
+0x80000000 PBE (Pending break enabled)
+
+[error_detecting_names] memory controller error detecting method
+0x01 Other
+0x02 Unknown
+0x03 None
+0x04 8-bit Parity
+0x05 32-bit ECC
+0x06 64-bit ECC
+0x07 128-bit ECC
+0x08 CRC
+
+[error_correcting_names] memory controller error correcting capability flags
+0x01 Other
+0x02 Unknown
+0x04 None
+0x08 Single-Bit Error Correcting
+0x10 Double-Bit Error Correcting
+0x20 Error Scrubbing
+
+[interleave_names] memory controller interleave
+0x01 Other
+0x02 Unknown
+0x03 One-Way Interleave
+0x04 Two-Way Interleave
+0x05 Four-Way Interleave
+0x06 Eight-Way Interleave
+0x07 Sixteen-Way Interleave
+
+[module_type_names] memory module type flags
+0x0001 Other
+0x0002 Unknown
+0x0004 Standard
+0x0008 Fast Page Mode
+0x0010 EDO
+0x0020 Parity
+0x0040 ECC
+0x0080 SIMM
+0x0100 DIMM
+0x0200 Burst EDO
+0x0400 SDRAM
+
+[cache_location_names] cache location, bits 6:5 of configuration
+0x00 Internal
+0x20 External
+0x40 Reserved
+0x60 Unknown
+
+[cache_mode_names] cache operational mode, bits 9:8 of configuration
+0x000 Write Through
+0x100 Write Back
+0x200 Varies with Memory Address
+0x300 Unknown
+
+[sram_type_names] cache sram type flags
+0x01 Other
+0x02 Unknown
+0x04 Non-Burst
+0x08 Burst
+0x10 Pipeline Burst
+0x20 Synchronous
+0x40 Asynchronous
+
+[cache_correction_names] cache error correction type
+0x01 Other
+0x02 Unknown
+0x03 None
+0x04 Parity
+0x05 Single-bit ECC
+0x06 Multi-bit ECC
+
+[system_cache_type_names] system cache type
+0x01 Other
+0x02 Unknown
+0x03 Instruction
+0x04 Data
+0x05 Unified
+
+[associativity_names] cache associativity
+0x01 Other
+0x02 Unknown
+0x03 Direct Mapped
+0x04 2-way Set-Associative
+0x05 4-way Set-Associative
+0x06 Fully Associative
+0x07 8-way Set-Associative
+0x08 16-way Set-Associative
+0x09 12-way Set-Associative
+0x0A 24-way Set-Associative
+0x0B 32-way Set-Associative
+0x0C 48-way Set-Associative
+0x0D 64-way Set-Associative
+0x0E 20-way Set-Associative
+
+[connector_type_names] connector type
+0x00 None
+0x01 Centronics
+0x02 Mini Centronics
+0x03 Proprietary
+0x04 DB-25 pin male
+0x05 DB-25 pin female
+0x06 DB-15 pin male
+0x07 DB-15 pin female
+0x08 DB-9 pin male
+0x09 DB-9 pin female
+0x0A RJ-11
+0x0B RJ-45
+0x0C 50-pin MiniSCSI
+0x0D Mini-DIN
+0x0E Micro-DIN
+0x0F PS/2
+0x10 Infrared
+0x11 HP-HIL
+0x12 Access Bus (USB)
+0x13 SSA SCSI
+0x14 Circular DIN-8 male
+0x15 Circular DIN-8 female
+0x16 On Board IDE
+0x17 On Board Floppy
+0x18 9-pin Dual Inline (pin 10 cut)
+0x19 25-pin Dual Inline (pin 26 cut)
+0x1A 50-pin Dual Inline
+0x1B 68-pin Dual Inline
+0x1C On Board Sound Input from CD-ROM
+0x1D Mini-Centronics Type-14
+0x1E Mini-Centronics Type-26
+0x1F Mini-jack (headphones)
+0x20 BNC
+0x21 1394
+0x22 SAS/SATA Plug Receptacle
+0x23 USB Type-C Receptacle
+0xA0 PC-98
+0xA1 PC-98Hireso
+0xA2 PC-H98
+0xA3 PC-98Note
+0xA4 PC-98Full
+0xFF Other
+
+[port_type_names] port type
+0x00 None
+0x01 Parallel Port XT/AT Compatible
+0x02 Parallel Port PS/2
+0x03 Parallel Port ECP
+0x04 Parallel Port EPP
+0x05 Parallel Port ECP/EPP
+0x06 Serial Port XT/AT Compatible
+0x07 Serial Port 16450 Compatible
+0x08 Serial Port 16550 Compatible
+0x09 Serial Port 16550A Compatible
+0x0A SCSI Port
+0x0B MIDI Port
+0x0C Joy Stick Port
+0x0D Keyboard Port
+0x0E Mouse Port
+0x0F SSA SCSI
+0x10 USB
+0x11 FireWire (IEEE P1394)
+0x12 PCMCIA Type I2
+0x13 PCMCIA Type II
+0x14 PCMCIA Type III
+0x15 Card bus
+0x16 Access Bus Port
+0x17 SCSI II
+0x18 SCSI Wide
+0x19 PC-98
+0x1A PC-98-Hireso
+0x1B PC-H98
+0x1C Video Port
+0x1D Audio Port
+0x1E Modem Port
+0x1F Network Port
+0x20 SATA
+0x21 SAS
+0x22 MFDP (Multi-Function Display Port)
+0x23 Thunderbolt
+0xA0 8251 Compatible
+0xA1 8251 FIFO Compatible
+0xFF Other
+
+[slot_type_names] slot type
+0x01 Other
+0x02 Unknown
+0x03 ISA
+0x04 MCA
+0x05 EISA
+0x06 PCI
+0x07 PC Card (PCMCIA)
+0x08 " VL-VESA"
+0x09 Proprietary
+0x0A Processor Card Slot
+0x0B Proprietary Memory Card Slot
+0x0C I/O Riser Card Slo
+0x0D NuBus
+0x0E PCI – 66MHz Capable
+0x0F AGP
+0x10 AGP 2X
+0x11 AGP 4X
+0x12 PCI-X
+0x13 AGP 8X
+0x14 M.2 Socket 1-DP (Mechanical Key A)
+0x15 M.2 Socket 1-SD (Mechanical Key E)
+0x16 M.2 Socket 2 (Mechanical Key B)
+0x17 M.2 Socket 3 (Mechanical Key M)
+0x18 MXM Type I
+0x19 MXM Type II
+0x1A MXM Type III (standard connector)
+0x1B MXM Type III (HE connector)
+0x1C MXM Type IV
+0x1D MXM 3.0 Type A
+0x1E MXM 3.0 Type B
+0x1F PCI Express Gen 2 SFF-8639 (U.2)
+0x20 PCI Express Gen 3 SFF-8639 (U.2)
+0x21 PCI Express Mini 52-pin (CEM spec. 2.0)
+0x22 PCI Express Mini 52-pin (CEM spec. 2.0)
+0x23 PCI Express Mini 76-pin (CEM spec. 2.0)
+0x24 PCI Express Gen 4 SFF-8639 (U.2)
+0x25 PCI Express Gen 5 SFF-8639 (U.2)
+0x26 OCP NIC 3.0 Small Form Factor (SFF)
+0x27 OCP NIC 3.0 Large Form Factor (LFF)
+0x28 OCP NIC Prior to 3.0
+0x30 CXL Flexbus 1.0
+0xA0 PC-98/C20
+0xA1 PC-98/C24
+0xA2 PC-98/E
+0xA3 PC-98/Local Bus
+0xA4 PC-98/Card
+0xA5 PCI Express (see note below)
+0xA6 PCI Express x1
+0xA7 PCI Express x2
+0xA8 PCI Express x4
+0xA9 PCI Express x8
+0xAA PCI Express x16
+0xAB PCI Express Gen 2
+0xAC PCI Express Gen 2 x1
+0xAD PCI Express Gen 2 x2
+0xAE PCI Express Gen 2 x4
+0xAF PCI Express Gen 2 x8
+0xB0 PCI Express Gen 2 x16
+0xB1 PCI Express Gen 3
+0xB2 PCI Express Gen 3 x1
+0xB3 PCI Express Gen 3 x2
+0xB4 PCI Express Gen 3 x4
+0xB5 PCI Express Gen 3 x8
+0xB6 PCI Express Gen 3 x16
+0xB7 PCI Express Gen 4
+0xB8 PCI Express Gen 4 x1
+0xB9 PCI Express Gen 4 x2
+0xBA PCI Express Gen 4 x4
+0xBB PCI Express Gen 4 x4
+0xBC PCI Express Gen 4 x8
+0xBD PCI Express Gen 4 x16
+0xBE PCI Express Gen 5
+0xBF PCI Express Gen 5 x2
+0xC0 PCI Express Gen 5 x2
+0xC1 PCI Express Gen 5 x4
+0xC2 PCI Express Gen 5 x8
+0xC3 PCI Express Gen 5 x16
+0xC4 PCI Express Gen 6 and Beyond
+0xC5 Enterprise and Datacenter 1U E1 Form Factor Slot (EDSFF E1.S, E1.L)
+0xC6 Enterprise and Datacenter 3' E3 Form Factor Slot (EDSFF E3.S, E3.L)
+
+[slot_width_names] slot data bus and physical width
+0x01 Other
+0x02 Unknown
+0x03 8 bit
+0x04 16 bit
+0x05 32 bit
+0x06 64 bit
+0x07 128 bit
+0x08 1x or x1
+0x09 2x or x2
+0x0A 4x or x4
+0x0B 8x or x8
+0x0C 12x or x12
+0x0D 16x or x16
+0x0E 32x or x32
+
+[slot_usage_names] slot current usage
+0x01 Other
+0x02 Unknown
+0x03 Available
+0x04 In use
+0x05 Unavailable
+
+[slot_length_names] slot length
+0x01 Other
+0x02 Unknown
+0x03 Short Length
+0x04 Long Length
+0x05 2.5' drive form factor
+0x06 3.5' drive form factor
+
+[slot_characteristics_1_names] slot characteristics 1 flags
+0x01 Unknown
+0x02 Provides 5.0 volts
+0x04 Provides 3.3 volts
+0x08 Slot’s opening is shared with another slot (for example, PCI/EISA shared slot)
+0x10 PC Card slot supports PC Card-16.
+0x20 PC Card slot supports CardBus
+0x40 PC Card slot supports Zoom Video
+0x80 PC Card slot supports Modem Ring Resume
+
+[slot_characteristics_2_names] slot characteristics 2 flags
+0x01 PCI slot supports Power Management Event (PME#) signal
+0x02 Slot supports hot-plug devices
+0x04 PCI slot supports SMBus signal
+0x08 PCIe slot supports bifurcation
+0x10 Slot supports async/surprise removal
+0x20 Flexbus slot, CXL 1.0 capable
+0x40 Flexbus slot, CXL 2.0 capable
+0x80 Reserved
+
+[log_access_names] event log access method
+0x00 Indexed I/O, one 8-bit index port, one 8-bit data port
+0x01 Indexed I/O, two 8-bit index ports, one 8-bit data port
+0x02 Indexed I/O, one 16-bit index port, one 8-bit data port
+0x03 Memory-mapped physical 32-bit address
+0x04 General-purpose non-volatile data functions
+
+[log_status_names] event log status flags
+0x01 Valid
+0x02 Full
+
+[log_header_names] event log header format
+0x00 No header
+0x01 Type 1 log header
+
+[log_type_names] event log type of supported log type descriptor
+0x01 Single-bit ECC memory error
+0x02 Multi-bit ECC memory error
+0x03 Parity memory error
+0x04 Bus time-out
+0x05 I/O Channel Check
+0x06 Software NMI
+0x07 POST Memory Resize
+0x08 POST Error
+0x09 PCI Parity Error
+0x0A PCI System Error
+0x0B CPU Failure
+0x0C EISA FailSafe Timer time-out
+0x0D Correctable memory log disabled
+0x0E Logging disabled for a specific Event Type
+0x0F Reserved
+0x10 System Limit Exceeded
+0x11 Asynchronous hardware timer expired
+0x12 System configuration information
+0x13 Hard-disk information
+0x14 System reconfigured
+0x15 Uncorrectable CPU-complex error
+0x16 Log Area Reset/Cleared
+0x17 System boot
+
+[log_data_format_names] event log variable data format type of supported log type descriptor
+0x00 None
+0x01 Handle
+0x02 Multiple-event
+0x03 Multiple-event handle
+0x04 POST results bitmap
+0x05 System management type
+0x06 Multiple-event system management type
+
+[array_location_names] memory array location
+0x01 Other
+0x02 Unknown
+0x03 System board or motherboard
+0x04 ISA add-on card
+0x05 EISA add-on card
+0x06 PCI add-on card
+0x07 MCA add-on card
+0x08 PCMCIA add-on card
+0x09 Proprietary add-on card
+0x0A NuBus
+0xA0 PC-98/C20 add-on card
+0xA1 PC-98/C24 add-on card
+0xA2 PC-98/E add-on card
+0xA3 PC-98/Local bus add-on card
+0xA4 CXL add-on card
+
+[array_use_names] memory array use
+0x01 Other
+0x02 Unknown
+0x03 System memory
+0x04 Video memory
+0x05 Flash memory
+0x06 Non-volatile RAM
+0x07 Cache memory
+
+[array_correction_names] memory array error correction
+0x01 Other
+0x02 Unknown
+0x03 None
+0x04 Parity
+0x05 Single-bit ECC
+0x06 Multi-bit ECC
+0x07 CRC
+
+[memory_form_factor_names] memory device form factor
+0x01 Other
+0x02 Unknown
+0x03 SIMM
+0x04 SIP
+0x05 Chip
+0x06 DIP
+0x07 ZIP
+0x08 Property Card
+0x09 DIMM
+0x0A TSOP
+0x0B Row of chips
+0x0C RIMM
+0x0D SODIMM
+0x0E SRIMM
+0x0F FB-DIMM
+0x10 Die
+
+[memory_type_names] memory device type
+0x01 Other
+0x02 Unknown
+0x03 DRAM
+0x04 EDRAM
+0x05 VRAM
+0x06 SRAM
+0x07 RAM
+0x08 ROM
+0x09 FLASH
+0x0A EEPROM
+0x0B FEPROM
+0x0C EPROM
+0x0D CDRAM
+0x0E 3DRAM
+0x0F SDRAM
+0x10 SGRAM
+0x11 RDRAM
+0x12 DDR
+0x13 DDR2
+0x14 DDR2 FB-DIMM
+0x18 DDR3
+0x19 FBD2
+0x1A DDR4
+0x1B LPDDR
+0x1C LPDDR2
+0x1D LPDDR3
+0x1E LPDDR4
+0x1F Logical non-volatile device
+0x20 HBM
+0x21 HBM2
+0x22 DDR5
+0x23 LPDDR5
+0x24 HBM3
+
+[memory_type_detail_names] memory device type detail flags
+0x0000 Reserved
+0x0001 Other
+0x0002 Unknown
+0x0004 Fast-paged
+0x0008 Static colunm
+0x0010 Pseudo static
+0x0020 RAMBUS
+0x0040 Synchronous
+0x0080 CMOS
+0x0100 EDO
+0x0200 Window DRAM
+0x0400 Cache DRAM
+0x0800 Non-volatile
+0x1000 Buffered
+0x2000 Unbuffered
+0x4000 LRDIMM
+
+[memory_technology_names] memory device technology
+0x01 Other
+0x02 Unknown
+0x03 DRAM
+0x04 NVDIMM-N
+0x05 NVDIMM-F
+0x06 NVDIMM-P
+0x07 Intel Optane
+
+[memory_capability_names] memory operating mode capability flags
+0x01 Reserved
+0x02 Other
+0x04 Unknown
+0x08 Volatile memory
+0x10 Byte-accessible persistent memory
+0x20 Block-accessible persistent memory
+
+[error_type_names] memory error type
+0x01 Other
+0x02 Unknown
+0x03 OK
+0x04 Bad read
+0x05 Parity error
+0x06 Single-bit error
+0x07 Double-bit error
+0x08 Multi-bit error
+0x09 Nibble error
+0x0A Checksum error
+0x0B CRC error
+0x0C Corrected single-bit error
+0x0D Corrected error
+0x0E Uncorrectable error
+
+[error_granularity_names] memory error granularity
+0x01 Other
+0x02 Unknown
+0x03 Device level
+0x04 Memory partition level
+
+[error_operation_names] memory error operation
+0x01 Other
+0x02 Unknown
+0x03 Read
+0x04 Write
+0x05 Partial write
+
+[pointing_type_names] pointing device type
+0x01 Other
+0x02 Unknown
+0x03 Mouse
+0x04 Track Ball
+0x05 Track Point
+0x06 Glide Point
+0x07 Touch Pad
+0x08 Touch Screen
+0x09 Optical Sensor
+
+[pointing_interface_names] pointing device interface
+0x01 Other
+0x02 Unknown
+0x03 Serial
+0x04 PS/2
+0x05 Infrared
+0x06 HP-HIL
+0x07 Bus mouse
+0x08 ADB (Apple Desktop Bus)
+0xA0 Bus mouse DB-9
+0xA1 Bus mouse micro-DIN
+0xA2 USB
+0xA3 I2C
+0xA4 SPI
+
+[battery_chemistry_names] battery chemistry
+0x01 Other
+0x02 Unknown
+0x03 Lead Acid
+0x04 Nickel Cadmium
+0x05 Nickel metal hydride
+0x06 Lithium-ion
+0x07 Zinc air
+0x08 Lithium Polymer
+
+[reset_status_names] system reset status, bit 0 of capabilities
+0x00 Disabled
+0x01 Enabled
+
+[reset_limit_option_names] system reset boot option on limit, bits 2:1 of capabilities
+0x02 Operating System
+0x04 System utilities
+0x06 Do not reboot
+
+[reset_option_names] system reset boot option, bits 4:3 of capabilities
+0x08 Operating System
+0x10 System utilities
+0x18 Do not reboot
+
+[reset_watchdog_names] watchdog timer, bit 5 of capabilities
+0x00 Not present
+0x20 Present
+
+[remote_access_names] out-of-band remote access connections
+0x01 Inbound connection enabled
+0x02 Outbound connection enabled
+
+[boot_status_names] system boot status, first byte of boot status field
+0x00 No errors detected
+0x01 No bootable media
+0x02 Operating system failed to load
+0x03 Firmware-detected hardware failure
+0x04 Operating system-detected hardware failure
+0x05 User-requested boot
+0x06 System security violation
+0x07 Previously-requested image
+0x08 System watchdog timer expired
+
+[management_type_names] management device type
+0x01 Other
+0x02 Unknown
+0x03 National Semiconductor LM75
+0x04 National Semiconductor LM78
+0x05 National Semiconductor LM79
+0x06 National Semiconductor LM80
+0x07 National Semiconductor LM81
+0x08 Analog Devices ADM9240
+0x09 Dallas Semiconductor DS1780
+0x0A Maxim 1617
+0x0B Genesys GL518SM
+0x0C Winbond W83781D
+0x0D Holtek HT82H791
+
+[management_address_names] management device address type
+0x01 Other
+0x02 Unknown
+0x03 I/O Port
+0x04 Memory
+0x05 SM Bus
+
+[channel_type_names] memory channel type
+0x01 Other
+0x02 Unknown
+0x03 RamBus
+0x04 SyncLink
+
+[ipmi_interface_names] ipmi interface type
+0x00 Unknown
+0x01 KCS: Keyboard Controller Style
+0x02 SMIC: Server Management Interface Chip
+0x03 BT: Block Transfer
+0x04 SSIF: SMBus System Interface
+
+[ipmi_space_names] ipmi base address space, bit 0 of base address
+0x00 Memory-mapped
+0x01 I/O
+
+[ipmi_spacing_names] ipmi register spacing, bits 7:6 of base address modifier
+0x00 Successive byte boundaries
+0x40 32-bit boundaries
+0x80 16-byte boundaries
+
+[ipmi_interrupt_names] ipmi interrupt information, bits 3, 1 and 0 of base address modifier
+0x01 Level triggered
+0x02 Active high
+0x08 Interrupt information specified
+
+[supply_type_names] power supply type, bits 13:10 of characteristics
+0x0400 Other
+0x0800 Unknown
+0x0C00 Linear
+0x1000 Switching
+0x1400 Battery
+0x1800 UPS
+0x1C00 Converter
+0x2000 Regulator
+
+[supply_status_names] power supply status, bits 9:7 of characteristics
+0x0080 Other
+0x0100 Unknown
+0x0180 OK
+0x0200 Non-critical
+0x0280 Critical
+
+[supply_range_names] power supply input voltage range switching, bits 6:3 of characteristics
+0x0008 Other
+0x0010 Unknown
+0x0018 Manual
+0x0020 Auto-switch
+0x0028 Wide range
+0x0030 Not applicable
+
+[supply_state_names] power supply state, bits 2:0 of characteristics
+0x0001 Hot-replaceable
+0x0002 Present
+0x0004 Unplugged
+
+[onboard_type_names] onboard device type, bits 6:0 of device type byte
+0x01 Other
+0x02 Unknown
+0x03 Video
+0x04 SCSI Controller
+0x05 Ethernet
+0x06 Token Ring
+0x07 Sound
+0x08 PATA Controller
+0x09 SATA Controller
+0x0A SAS Controller
+0x0B Wireless LAN
+0x0C Bluetooth
+0x0D WWAN
+0x0E " eMMC (embedded Multi-Media Controller)"
+0x0F NVMe Controller
+0x10 UFS Controller
+
+[onboard_status_names] onboard device status, bit 7 of device type byte
+0x00 Disabled
+0x80 Enabled
+
+[host_interface_names] management controller host interface type
+0x02 KCS: Keyboard Controller Style
+0x03 8250 UART Register Compatible
+0x04 16450 UART Register Compatible
+0x05 16550/16550A UART Register Compatible
+0x06 16650/16650A UART Register Compatible
+0x07 16750/16750A UART Register Compatible
+0x08 16850/16850A UART Register Compatible
+0x40 Network Host Interface
+0xF0 OEM
+
+[host_protocol_names] management controller host interface protocol type
+0x02 IPMI
+0x03 MCTP
+0x04 Redfish over IP
+0xF0 OEM
+
+[tpm_characteristics_names] tpm device characteristics
+0x04 TPM Device characteristics not supported
+0x08 Family configurable via firmware update
+0x10 Family configurable via platform software support
+0x20 Family configurable via OEM proprietary mechanism
+
+[firmware_version_format_names] firmware version format
+0x00 Free-form string
+0x01 MAJOR.MINOR
+0x02 32-bit hexadecimal string
+0x03 64-bit hexadecimal string
+
+[firmware_id_format_names] firmware id format
+0x00 Free-form string
+0x01 UEFI GUID
+
+[firmware_characteristics_names] firmware characteristics
+0x0001 Updatable
+0x0002 Write-Protect
+
+[firmware_state_names] firmware state
+0x01 Other
+0x02 Unknown
+0x03 Disabled
+0x04 Enabled
+0x05 Absent
+0x06 StandbyOffline
+0x07 StandbySpare
+0x08 UnavailableOffline
+
+[probe_status_names] probe status, bits 7:5 of location and status byte
+0x01 Other
+0x02 Unknown
+0x03 OK
+0x04 Non-critical
+0x05 Critical
+0x06 Non-recoverable
+
+[probe_location_names] probe location, bits 4:0 of location and status byte
+0x01 Other
+0x02 Unknown
+0x03 Processor
+0x04 Disk
+0x05 Peripheral Bay
+0x06 System Management Module
+0x07 Motherboard
+0x08 Memory Module
+0x09 Processor Module
+0x0A Power Unit
+0x0B Add-in Card
+0x0C Front Panel Board
+0x0D Back Panel Board
+0x0E Power System Board
+0x0F Drive Back Plane
+
+[cooling_type_names] cooling device type, bits 4:0 of device type and status byte
+0x01 Other
+0x02 Unknown
+0x03 Fan
+0x04 Centrifugal Blower
+0x05 Chip Fan
+0x06 Cabinet Fan
+0x07 Power Supply Fan
+0x08 Heat Pipe
+0x09 Integrated Refrigeration
+0x10 Active Cooling
+0x11 Passive Cooling
+
+[probe_object_names] probe object types
+26 voltage_probe
+27 cooling_device
+28 temperature_probe
+29 electrical_current_probe
+36 management_device_threshold_data
+
+[processor_architecture_names] processor architecture type of processor specific block
+0x01 IA32 (x86)
+0x02 x64 (x86-64, Intel64, AMD64, EM64T)
+0x03 Intel Itanium architecture
+0x04 32-bit ARM (Aarch32)
+0x05 64-bit ARM (Aarch64)
+0x06 32-bit RISC-V (RV32)
+0x07 64-bit RISC-V (RV64)
+0x08 128-bit RISC-V (RV128)
+0x09 32-bit LoongArch (LoongArch32)
+0x0A 64-bit LoongArch (LoongArch64)
+
+[riscv_xlen_names] RISC-V register width
+0x00 Unsupported
+0x01 32-bit
+0x02 64-bit
+0x03 128-bit
+
+[riscv_privilege_names] RISC-V privilege level flags
+0x01 Machine Mode
+0x04 Supervisor Mode
+0x08 User Mode
+
+[password_status_names] hardware security status, 2 bits
+0x00 Disabled
+0x01 Enabled
+0x02 Not Implemented
+0x03 Unknown
@@ -0,0 +1,34 @@
+#include "pool.h"
+#include "hash.h"
+
+std::uint32_t string_pool::intern(const char *data, std::size_t size)
+{
+    //id holds shard in low bits and position in shard above them
+    const std::uint32_t& shard_index {static_cast<std::uint32_t>(xxh64(data,size) % shards_count_)};
+    shard& item {shards_[shard_index]};
+    const std::lock_guard<std::mutex> lock {item.mutex_};
+    const auto& inserted {item.ids_.emplace(std::string {data,size},
+                                            static_cast<std::uint32_t>(item.strings_.size()*shards_count_+shard_index))};
+    if(inserted.second){
+        item.strings_.push_back(&inserted.first->first);
+    }
+    return inserted.first->second;
+}
+
+std::string string_pool::get(std::uint32_t id) const
+{
+    const shard& item {shards_[id % shards_count_]};
+    const std::lock_guard<std::mutex> lock {item.mutex_};
+    const std::size_t& index {id / shards_count_};
+    return index < item.strings_.size() ? *item.strings_[index] : std::string {};
+}
+
+std::size_t string_pool::size() const
+{
+    std::size_t count {0};
+    for(const shard& item: shards_){
+        const std::lock_guard<std::mutex> lock {item.mutex_};
+        count+=item.strings_.size();
+    }
+    return count;
+}
@@ -0,0 +1,42 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+//interned strings with stable ids, shared by decoders and column builders of batch workers
+class string_pool
+{
+private:
+    //independent shards to keep lock contention low between worker threads
+    static const std::uint32_t shards_count_ {16};
+    struct shard
+    {
+        mutable std::mutex mutex_ {};
+        std::unordered_map<std::string,std::uint32_t> ids_ {};
+        //map keys in id order, node keys keep address on rehash
+        std::vector<const std::string*> strings_ {};
+    };
+    shard shards_[shards_count_];
+
+public:
+    explicit string_pool()=default;
+    ~string_pool()=default;
+    string_pool(const string_pool&)=delete;
+    string_pool& operator=(const string_pool&)=delete;
+
+    //id of string, equal strings get equal ids for lifetime of pool
+    std::uint32_t intern(const char* data, std::size_t size);
+    inline std::uint32_t intern(const std::string& value){
+        return intern(value.data(),value.size());
+    }
+    //string of id returned by intern
+    std::string get(std::uint32_t id)const;
+    //count of distinct strings
+    std::size_t size()const;
+};
+
+#endif // POOL_H
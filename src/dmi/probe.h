@@ -0,0 +1,38 @@
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <boost/json.hpp>
+
+//probe reading without strings, types 26, 27, 28 and 29
+struct probe
+{
+    //type and handle of probe structure
+    int type_ {0};
+    int handle_ {0};
+
+    //location code (cooling device type for type 27), bits 4:0
+    unsigned char location_ {0};
+
+    //status code, bits 7:5
+    unsigned char status_ {0};
+
+    //values in volts, degrees C, amperes or rpm (type 27 nominal speed), 0 if unknown
+    double maximum_value_ {0};
+    double minimum_value_ {0};
+    double nominal_value_ {0};
+
+    boost::json::object to_json()const{
+        const boost::json::object& out_object {
+            {"type", type_},
+            {"handle", handle_},
+            {"location_code", location_},
+            {"status_code", status_},
+            {"maximum_value", maximum_value_},
+            {"minimum_value", minimum_value_},
+            {"nominal_value", nominal_value_}
+        };
+        return out_object;
+    }
+};
+
+#endif // PROBE_H
@@ -0,0 +1,212 @@
+#include "query.h"
+#include "decoder.h"
+
+#include <cstdlib>
+#include <sstream>
+
+#include <boost/format.hpp>
+#include <boost/algorithm/string.hpp>
+
+namespace {
+//compare two scalar json values, numbers numerically and strings lexically
+bool compare(const boost::json::value& left, const std::string& op, const boost::json::value& right)
+{
+    int order {0};
+    if(left.is_string() || right.is_string()){
+        if(!left.is_string() || !right.is_string()){
+            return op=="!=";
+        }
+        order=std::string(left.as_string().c_str()).compare(right.as_string().c_str());
+    }
+    else{
+        const double& l {left.to_number<double>()};
+        const double& r {right.to_number<double>()};
+        order=(l < r) ? -1 : (l > r) ? 1 : 0;
+    }
+
+    if(op=="=" || op=="=="){
+        return order==0;
+    }
+    if(op=="!="){
+        return order!=0;
+    }
+    if(op=="<"){
+        return order<0;
+    }
+    if(op=="<="){
+        return order<=0;
+    }
+    if(op==">"){
+        return order>0;
+    }
+    if(op==">="){
+        return order>=0;
+    }
+    return false;
+}
+}
+
+bool query::compile(const std::string &text)
+{
+    plans_.clear();
+    error_str_.clear();
+
+    std::vector<std::string> statements;
+    boost::split(statements,text,boost::is_any_of(";"));
+    for(const std::string& statement: statements){
+        if(boost::trim_copy(statement).empty()){
+            continue;
+        }
+        if(!compile_statement(statement)){
+            plans_.clear();
+            return false;
+        }
+    }
+    if(plans_.empty()){
+        error_str_="Empty query";
+        return false;
+    }
+    return true;
+}
+
+bool query::compile_statement(const std::string &text)
+{
+    //split into projection and filter parts
+    std::string projection {boost::trim_copy(text)};
+    std::string filter {};
+    const std::size_t& where_pos {projection.find(" where ")};
+    if(where_pos!=std::string::npos){
+        filter=boost::trim_copy(projection.substr(where_pos + 7));
+        projection=boost::trim_copy(projection.substr(0,where_pos));
+    }
+
+    //projection: type <number> <field>[,<field>...]
+    std::istringstream iss {projection};
+    std::string keyword {};
+    int type {-1};
+    if(!(iss>>keyword) || keyword!="type" || !(iss>>type) || type<0 || type>255){
+        error_str_="Query must start with 'type <number>': " + text;
+        return false;
+    }
+
+    std::string fields_list {};
+    std::getline(iss,fields_list);
+    std::vector<std::string> names;
+    boost::split(names,fields_list,boost::is_any_of(", "),boost::token_compress_on);
+
+    plan current {};
+    current.type_=type;
+    for(const std::string& name: names){
+        if(name.empty()){
+            continue;
+        }
+        field projected {};
+        if(!find_field(type,name,projected)){
+            return false;
+        }
+        current.fields_.push_back(projected);
+    }
+
+    //filter: <field><op><value>[ and <field><op><value>...]
+    if(!filter.empty()){
+        std::vector<std::string> conditions;
+        boost::iter_split(conditions,filter,boost::algorithm::first_finder(" and "));
+        for(const std::string& text_condition: conditions){
+            condition compiled {};
+            if(!compile_condition(type,boost::trim_copy(text_condition),compiled)){
+                return false;
+            }
+            current.conditions_.push_back(compiled);
+        }
+    }
+
+    plans_.push_back(current);
+    return true;
+}
+
+bool query::find_field(int type, const std::string &name, field &out)
+{
+    const type_layout* found {decoder::find_layout(type)};
+    for(std::size_t i=0;found && i<found->size_;++i){
+        if(name==found->fields_[i].name_){
+            out.name_=name;
+            out.layout_=&found->fields_[i];
+            return true;
+        }
+    }
+    error_str_=(boost::format("Unknown field '%s' for type %d")
+                % name
+                % type).str();
+    return false;
+}
+
+bool query::compile_condition(int type, const std::string &text, condition &out)
+{
+    const std::size_t& op_pos {text.find_first_of("<>=!")};
+    if(op_pos==std::string::npos || op_pos==0){
+        error_str_="Invalid condition: " + text;
+        return false;
+    }
+    std::size_t op_end {op_pos + 1};
+    if(op_end < text.size() && text.at(op_end)=='='){
+        ++op_end;
+    }
+
+    const std::string& name {boost::trim_copy(text.substr(0,op_pos))};
+    const std::string& op {text.substr(op_pos,op_end - op_pos)};
+    std::string value {boost::trim_copy(text.substr(op_end))};
+    if(op=="!"){
+        error_str_="Invalid operator in condition: " + text;
+        return false;
+    }
+
+    if(!find_field(type,name,out.field_)){
+        return false;
+    }
+    out.op_=op;
+
+    //quoted values and non numeric values are compared as strings
+    if(value.size() >= 2 && (value.front()=='"' || value.front()=='\'') && value.back()==value.front()){
+        out.value_=value.substr(1,value.size() - 2);
+        return true;
+    }
+    char* parsed {nullptr};
+    const double& number {std::strtod(value.c_str(),&parsed)};
+    if(!value.empty() && parsed==value.c_str()+value.size()){
+        out.value_=number;
+        return true;
+    }
+    out.value_=value;
+    return true;
+}
+
+bool query::matches(const structure &dmi, const plan &current, int version) const
+{
+    for(const condition& filter: current.conditions_){
+        if(!compare(decode_field(dmi,*filter.field_.layout_,version),filter.op_,filter.value_)){
+            return false;
+        }
+    }
+    return true;
+}
+
+boost::json::array query::run(const std::vector<structure> &structures, int version) const
+{
+    boost::json::array out_array;
+    for(const structure& dmi: structures){
+        for(const plan& current: plans_){
+            if(current.type_!=dmi.type_ || !matches(dmi,current,version)){
+                continue;
+            }
+            boost::json::object out_object {
+                {"type", dmi.type_},
+                {"handle", dmi.handle_}
+            };
+            for(const field& projected: current.fields_){
+                out_object.emplace(projected.name_,decode_field(dmi,*projected.layout_,version));
+            }
+            out_array.push_back(out_object);
+        }
+    }
+    return out_array;
+}
@@ -0,0 +1,58 @@
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <string>
+#include <vector>
+#include "layout.h"
+#include "structure.h"
+#include <boost/json.hpp>
+
+//compiled field projection over raw structures, e.g. "type 17 size,speed where size>0".
+//Fields are those of decoder field layouts, values equal decoded records
+class query
+{
+private:
+    struct field
+    {
+        std::string name_ {};
+        const field_layout* layout_ {nullptr};
+    };
+
+    struct condition
+    {
+        field field_ {};
+        std::string op_ {};
+        boost::json::value value_ {};
+    };
+
+    //one compiled statement: structure type, projected fields and filter
+    struct plan
+    {
+        int type_ {-1};
+        std::vector<field> fields_ {};
+        std::vector<condition> conditions_ {};
+    };
+
+    std::string error_str_ {};
+    std::vector<plan> plans_ {};
+
+    bool compile_statement(const std::string& text);
+    bool find_field(int type, const std::string& name, field& out);
+    bool compile_condition(int type, const std::string& text, condition& out);
+    bool matches(const structure& dmi, const plan& current, int version)const;
+
+public:
+    explicit query()=default;
+    ~query()=default;
+    inline std::string error()const{
+        return error_str_;
+    }
+
+    //compile statements separated by ';'
+    bool compile(const std::string& text);
+
+    //run compiled plan, one object per matched structure. Fields newer than table version are defaults
+    boost::json::array run(const std::vector<structure>& structures, int version)const;
+};
+
+#endif // QUERY_H
@@ -0,0 +1,64 @@
+#include "raw.h"
+#include "hex.h"
+
+#include <string>
+
+namespace {
+const char base64_chars[] {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+//standard base64 with padding, 3 bytes to 4 characters
+std::string base64_encode(const unsigned char* data, std::size_t size)
+{
+    std::string out((size+2)/3*4,'=');
+    char* it {&out[0]};
+    std::size_t i {0};
+    for(;i+3<=size;i+=3){
+        const unsigned int& group {(static_cast<unsigned int>(data[i]) << 16) | (data[i+1] << 8u) | data[i+2]};
+        it[0]=base64_chars[(group >> 18) & 0x3F];
+        it[1]=base64_chars[(group >> 12) & 0x3F];
+        it[2]=base64_chars[(group >> 6) & 0x3F];
+        it[3]=base64_chars[group & 0x3F];
+        it+=4;
+    }
+    //one or two trailing bytes, rest of last group is padding
+    if(i<size){
+        const unsigned int& group {(static_cast<unsigned int>(data[i]) << 16) | (i+1<size ? (data[i+1] << 8u) : 0u)};
+        it[0]=base64_chars[(group >> 18) & 0x3F];
+        it[1]=base64_chars[(group >> 12) & 0x3F];
+        if(i+1<size){
+            it[2]=base64_chars[(group >> 6) & 0x3F];
+        }
+    }
+    return out;
+}
+}
+
+boost::json::object raw_structure(const structure &dmi, raw_encoding encoding)
+{
+    const unsigned char* data {reinterpret_cast<const unsigned char*>(dmi.data_.data())};
+    std::string formatted {};
+    if(encoding==raw_encoding::base64){
+        formatted=base64_encode(data,dmi.data_.size());
+    }
+    else{
+        formatted.assign(2*dmi.data_.size(),'0');
+        hex_encode(data,dmi.data_.size(),&formatted[0]);
+    }
+
+    boost::json::array strings;
+    strings.reserve(dmi.strings_.size());
+    for(const std::string& item: dmi.strings_){
+        strings.emplace_back(item);
+    }
+
+    const boost::json::object& out_object {
+        {"object_type", "raw_structure"},
+        {"type", dmi.type_},
+        {"handle", dmi.handle_},
+        {"length", dmi.length_},
+        {"encoding", encoding==raw_encoding::base64 ? "base64" : "hex"},
+        {"data", formatted},
+        {"strings", strings}
+    };
+    return out_object;
+}
@@ -0,0 +1,28 @@
+#ifndef RAW_H
+#define RAW_H
+
+#include "structure.h"
+#include <boost/json.hpp>
+
+//structures emitted as raw records instead of decoded objects
+enum class raw_mode
+{
+    //decoded objects only
+    none,
+    //raw records for structures without decoder, OEM types included
+    unknown,
+    //raw records for every structure, no decode pass
+    all
+};
+
+//encoding of raw formatted area
+enum class raw_encoding
+{
+    hex,
+    base64
+};
+
+//header, formatted area (header included) and strings of structure, as read from table
+boost::json::object raw_structure(const structure& dmi, raw_encoding encoding);
+
+#endif // RAW_H
@@ -0,0 +1,72 @@
+#ifndef RESULT_H
+#define RESULT_H
+
+#include <cstddef>
+#include <utility>
+
+//decode failures, reported without exceptions
+enum class decode_error
+{
+    ok,
+    //entry point file missing, empty or all zero
+    entry_unreadable,
+    //entry point anchor is not _SM_ or _SM3_
+    entry_anchor,
+    //entry point length is 0 or longer than entry point
+    entry_length,
+    //structure table missing, empty or all zero
+    table_unreadable,
+    //less than 4 header bytes left at structure offset
+    truncated_header,
+    //structure length is less than header size
+    short_length,
+    //structure formatted area ends past table end
+    area_past_end,
+    //structure strings set is not terminated by two null bytes
+    unterminated_strings
+};
+
+//short description of error code
+inline const char* error_message(decode_error error){
+    switch(error){
+    case decode_error::ok:
+        return "No error";
+    case decode_error::entry_unreadable:
+        return "Entry point unreadable";
+    case decode_error::entry_anchor:
+        return "Entry point anchor not found";
+    case decode_error::entry_length:
+        return "Entry point length error";
+    case decode_error::table_unreadable:
+        return "Structure table unreadable";
+    case decode_error::truncated_header:
+        return "Truncated structure header";
+    case decode_error::short_length:
+        return "Structure length less than header size";
+    case decode_error::area_past_end:
+        return "Structure past table end";
+    case decode_error::unterminated_strings:
+        return "Structure strings set not terminated";
+    }
+    return "Unknown error";
+}
+
+//decoded value with error code and byte offset of error in table
+//on table errors value holds everything decoded before offset
+template<class T>
+struct result
+{
+    T value_ {};
+    decode_error error_ {decode_error::ok};
+    std::size_t offset_ {0};
+
+    result()=default;
+    result(T value, decode_error error, std::size_t offset)
+        :value_{std::move(value)},error_{error},offset_{offset}{
+    }
+    explicit operator bool()const{
+        return error_==decode_error::ok;
+    }
+};
+
+#endif // RESULT_H
@@ -0,0 +1,47 @@
+#ifndef SUMMARY_H
+#define SUMMARY_H
+
+#include <boost/json.hpp>
+
+//host aggregates computed in one pass over raw structures
+struct summary
+{
+    //installed memory in bytes (type 17)
+    unsigned long long total_memory_ {0};
+
+    //memory device slots and populated ones (type 17)
+    int memory_devices_ {0};
+    int populated_memory_devices_ {0};
+
+    //processor sockets and populated ones (type 4)
+    int sockets_ {0};
+    int populated_sockets_ {0};
+
+    //cores, enabled cores and threads over populated sockets (type 4)
+    int cores_ {0};
+    int enabled_cores_ {0};
+    int threads_ {0};
+
+    //system slots and slots in use (type 9)
+    int slots_ {0};
+    int populated_slots_ {0};
+
+    boost::json::object to_json()const{
+        const boost::json::object& out_object {
+            {"object_type", "summary"},
+            {"total_memory", total_memory_},
+            {"memory_devices", memory_devices_},
+            {"populated_memory_devices", populated_memory_devices_},
+            {"sockets", sockets_},
+            {"populated_sockets", populated_sockets_},
+            {"cores", cores_},
+            {"enabled_cores", enabled_cores_},
+            {"threads", threads_},
+            {"slots", slots_},
+            {"populated_slots", populated_slots_}
+        };
+        return out_object;
+    }
+};
+
+#endif // SUMMARY_H
@@ -0,0 +1,18 @@
+#include <boost/throw_exception.hpp>
+
+#include <cstdlib>
+
+//library built without exceptions: boost reports errors here, decode paths never reach it
+#if defined(BOOST_NO_EXCEPTIONS)
+namespace boost {
+void throw_exception(const std::exception&)
+{
+    std::abort();
+}
+
+void throw_exception(const std::exception&, const boost::source_location&)
+{
+    std::abort();
+}
+}
+#endif
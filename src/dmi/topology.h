@@ -0,0 +1,126 @@
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+#include <string>
+#include <vector>
+#include <boost/json.hpp>
+
+//caches of one processor socket, resolved from type 4 cache handles to type 7
+struct cache_topology
+{
+    //handle and socket designation of processor structure (type 4)
+    int processor_handle_ {0};
+    std::string socket_designation_ {};
+
+    //handles of referenced cache structures, 0xFFFF if none
+    int l1_cache_handle_ {0xFFFF};
+    int l2_cache_handle_ {0xFFFF};
+    int l3_cache_handle_ {0xFFFF};
+
+    //installed size in bytes summed per cache level, levels 1 to 3
+    unsigned long long l1_size_ {0};
+    unsigned long long l2_size_ {0};
+    unsigned long long l3_size_ {0};
+
+    //referenced cache structures found, at most 3
+    int caches_ {0};
+
+    boost::json::object to_json()const{
+        const boost::json::object& out_object {
+            {"object_type", "cache_topology"},
+            {"processor_handle", processor_handle_},
+            {"socket_designation", socket_designation_},
+            {"l1_cache_handle", l1_cache_handle_},
+            {"l2_cache_handle", l2_cache_handle_},
+            {"l3_cache_handle", l3_cache_handle_},
+            {"l1_size", l1_size_},
+            {"l2_size", l2_size_},
+            {"l3_size", l3_size_},
+            {"caches", caches_}
+        };
+        return out_object;
+    }
+};
+
+//mapped address range (type 19 or 20) in bytes, end inclusive
+struct memory_range
+{
+    int handle_ {0};
+    unsigned long long start_ {0};
+    unsigned long long end_ {0};
+
+    boost::json::object to_json()const{
+        const boost::json::object& out_object {
+            {"handle", handle_},
+            {"start", start_},
+            {"end", end_}
+        };
+        return out_object;
+    }
+};
+
+//populated memory device (type 17) with its device mapped ranges (type 20)
+struct memory_slot
+{
+    int device_handle_ {0};
+    std::string device_locator_ {};
+    std::string bank_locator_ {};
+    //installed size in bytes
+    unsigned long long size_ {0};
+    std::vector<memory_range> ranges_ {};
+
+    boost::json::object to_json()const{
+        boost::json::array ranges;
+        for(const memory_range& range: ranges_){
+            ranges.emplace_back(range.to_json());
+        }
+        const boost::json::object& out_object {
+            {"device_handle", device_handle_},
+            {"device_locator", device_locator_},
+            {"bank_locator", bank_locator_},
+            {"size", size_},
+            {"ranges", ranges}
+        };
+        return out_object;
+    }
+};
+
+//memory array (type 16) with populated slots and array mapped ranges (type 19)
+struct memory_topology
+{
+    int array_handle_ {0};
+    //maximum capacity in bytes
+    unsigned long long maximum_capacity_ {0};
+    //slots declared by array and memory device structures referencing it
+    int memory_devices_ {0};
+    int slots_count_ {0};
+    //installed size of populated slots in bytes
+    unsigned long long total_size_ {0};
+    std::vector<memory_slot> slots_ {};
+    std::vector<memory_range> ranges_ {};
+
+    boost::json::object to_json()const{
+        boost::json::array slots;
+        for(const memory_slot& slot: slots_){
+            slots.emplace_back(slot.to_json());
+        }
+        boost::json::array ranges;
+        for(const memory_range& range: ranges_){
+            ranges.emplace_back(range.to_json());
+        }
+        const boost::json::object& out_object {
+            {"object_type", "memory_topology"},
+            {"array_handle", array_handle_},
+            {"maximum_capacity", maximum_capacity_},
+            {"memory_devices", memory_devices_},
+            {"slots_count", slots_count_},
+            {"populated_slots", slots_.size()},
+            {"total_size", total_size_},
+            {"slots", slots},
+            {"ranges", ranges}
+        };
+        return out_object;
+    }
+};
+
+#endif // TOPOLOGY_H
@@ -0,0 +1,94 @@
+#include "walker.h"
+#include "load.h"
+
+#include <cstring>
+#include <boost/format.hpp>
+
+structure structure_view::to_structure() const
+{
+    std::vector<std::string> strings;
+    const char* strings_end {strings_+strings_size_};
+    for(const char* item {strings_};item<strings_end;){
+        const char* item_end {static_cast<const char*>(std::memchr(item,'\0',strings_end-item))};
+        if(!item_end){
+            item_end=strings_end;
+        }
+        strings.emplace_back(item,item_end);
+        item=item_end+1;
+    }
+    return structure {type_,length_,handle_,std::vector<char>(data_,data_+length_),strings};
+}
+
+bool table_walker::next(structure_view &view)
+{
+    if(done_ || offset_>=size_){
+        return false;
+    }
+    const field_view table {table_,size_};
+    const char* table_end {table_+size_};
+    const std::size_t offset {offset_};
+    done_=true;
+
+    //structure header size
+    const int& header_size {4};
+
+    if(!table.has(offset,header_size)){
+        error_code_=decode_error::truncated_header;
+        error_offset_=offset;
+        error_str_=(boost::format("Truncated structure header at offset 0x%X, %d of %d bytes left")
+                    % offset % (size_-offset) % header_size).str();
+        return false;
+    }
+    const int& type {table.u8(offset)};
+    const int& length {table.u8(offset+1)};
+    const int& handle {table.u16(offset+2)};
+    if(length<header_size){
+        error_code_=decode_error::short_length;
+        error_offset_=offset;
+        error_str_=(boost::format("Structure type %d at offset 0x%X has length %d, less than header size %d")
+                    % type % offset % length % header_size).str();
+        return false;
+    }
+    if(!table.has(offset,length)){
+        error_code_=decode_error::area_past_end;
+        error_offset_=offset;
+        error_str_=(boost::format("Structure type %d at offset 0x%X has length %d, past table end at 0x%X")
+                    % type % offset % length % size_).str();
+        return false;
+    }
+
+    //strings set ends with two null bytes, set without strings is two null bytes only
+    const char* strings_begin {table_+offset+length};
+    const char* strings_end {strings_begin};
+    while(true){
+        strings_end=static_cast<const char*>(std::memchr(strings_end,'\0',table_end-strings_end));
+        if(!strings_end || strings_end+1>=table_end){
+            strings_end=nullptr;
+            break;
+        }
+        if(strings_end[1]=='\0'){
+            break;
+        }
+        ++strings_end;
+    }
+    if(!strings_end){
+        error_code_=decode_error::unterminated_strings;
+        error_offset_=offset;
+        error_str_=(boost::format("Structure type %d at offset 0x%X has strings set not terminated before table end at 0x%X")
+                    % type % offset % size_).str();
+        return false;
+    }
+
+    view.type_=type;
+    view.length_=length;
+    view.handle_=handle;
+    view.offset_=offset;
+    view.data_=table_+offset;
+    view.strings_=strings_begin;
+    view.strings_size_=static_cast<std::size_t>(strings_end-strings_begin);
+
+    //end-of-table structure, bytes after it are padding
+    offset_=static_cast<std::size_t>(strings_end-table_)+2;
+    done_=(type==127);
+    return true;
+}
@@ -0,0 +1,59 @@
+#ifndef WALKER_H
+#define WALKER_H
+
+#include <string>
+#include <cstddef>
+#include "result.h"
+#include "structure.h"
+
+//structure as it lies in table, valid while table bytes live
+struct structure_view
+{
+    int type_ {};
+    int length_ {};
+    int handle_ {};
+    //table offset of structure
+    std::size_t offset_ {0};
+    //formatted area, header included, length_ bytes
+    const char* data_ {nullptr};
+    //strings set without its two terminating null bytes, strings separated by null byte
+    const char* strings_ {nullptr};
+    std::size_t strings_size_ {0};
+
+    //owning copy of structure for decoding
+    structure to_structure()const;
+};
+
+//one pass walk over structure table, every part is checked against table end before it is read.
+//Walk ends after end-of-table structure (type 127), bytes after it are padding
+class table_walker
+{
+private:
+    const char* table_ {nullptr};
+    std::size_t size_ {0};
+    std::size_t offset_ {0};
+    bool done_ {false};
+    decode_error error_code_ {decode_error::ok};
+    std::size_t error_offset_ {0};
+    std::string error_str_ {};
+
+public:
+    explicit table_walker()=default;
+    explicit table_walker(const char* table, std::size_t size)
+        :table_{table},size_{size}{
+    }
+    //next structure, false at table end or at first malformed structure with error at its offset
+    bool next(structure_view& view);
+
+    inline std::string error()const{
+        return error_str_;
+    }
+    inline decode_error error_code()const{
+        return error_code_;
+    }
+    inline std::size_t error_offset()const{
+        return error_offset_;
+    }
+};
+
+#endif // WALKER_H
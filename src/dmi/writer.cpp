@@ -0,0 +1,149 @@
+#include "writer.h"
+
+namespace {
+const char hex_digits[] {"0123456789abcdef"};
+
+//quoted string with JSON escapes, other bytes (UTF-8 included) are copied
+void write_string(std::string& out, const char* data, std::size_t size)
+{
+    out.push_back('"');
+    for(std::size_t i=0;i<size;++i){
+        const unsigned char& item {static_cast<unsigned char>(data[i])};
+        switch(item){
+        case '"':
+            out+="\\\"";
+            break;
+        case '\\':
+            out+="\\\\";
+            break;
+        case '\b':
+            out+="\\b";
+            break;
+        case '\f':
+            out+="\\f";
+            break;
+        case '\n':
+            out+="\\n";
+            break;
+        case '\r':
+            out+="\\r";
+            break;
+        case '\t':
+            out+="\\t";
+            break;
+        default:
+            if(item < 0x20){
+                out+="\\u00";
+                out.push_back(hex_digits[item >> 4]);
+                out.push_back(hex_digits[item & 0x0F]);
+            }
+            else{
+                out.push_back(static_cast<char>(item));
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+void write_indent(std::string& out, int level)
+{
+    out.append(static_cast<std::size_t>(level)*4,' ');
+}
+
+//null, booleans, numbers and strings
+void write_scalar(std::string& out, const boost::json::value& value)
+{
+    if(value.is_string()){
+        write_string(out,value.get_string().data(),value.get_string().size());
+    }
+    else if(value.is_int64()){
+        out+=std::to_string(value.get_int64());
+    }
+    else if(value.is_uint64()){
+        out+=std::to_string(value.get_uint64());
+    }
+    else if(value.is_bool()){
+        out+=value.get_bool() ? "true" : "false";
+    }
+    else if(value.is_null()){
+        out+="null";
+    }
+    else{
+        //shortest round trip form of doubles is left to boost
+        out+=boost::json::serialize(value);
+    }
+}
+}
+
+void write_compact(std::string &out, const boost::json::value &value)
+{
+    if(value.is_object()){
+        out.push_back('{');
+        bool first {true};
+        for(const boost::json::key_value_pair& item: value.get_object()){
+            if(!first){
+                out.push_back(',');
+            }
+            first=false;
+            write_string(out,item.key().data(),item.key().size());
+            out.push_back(':');
+            write_compact(out,item.value());
+        }
+        out.push_back('}');
+    }
+    else if(value.is_array()){
+        out.push_back('[');
+        bool first {true};
+        for(const boost::json::value& item: value.get_array()){
+            if(!first){
+                out.push_back(',');
+            }
+            first=false;
+            write_compact(out,item);
+        }
+        out.push_back(']');
+    }
+    else{
+        write_scalar(out,value);
+    }
+}
+
+void write_pretty(std::string &out, const boost::json::value &value, int level)
+{
+    if(value.is_object()){
+        const boost::json::object& object {value.get_object()};
+        if(object.empty()){
+            out+="{}";
+            return;
+        }
+        out+="{\n";
+        std::size_t index {0};
+        for(const boost::json::key_value_pair& item: object){
+            write_indent(out,level+1);
+            write_string(out,item.key().data(),item.key().size());
+            out+=": ";
+            write_pretty(out,item.value(),level+1);
+            out+=++index<object.size() ? ",\n" : "\n";
+        }
+        write_indent(out,level);
+        out.push_back('}');
+    }
+    else if(value.is_array()){
+        const boost::json::array& array {value.get_array()};
+        if(array.empty()){
+            out+="[]";
+            return;
+        }
+        out+="[\n";
+        for(std::size_t i=0;i<array.size();++i){
+            write_indent(out,level+1);
+            write_pretty(out,array[i],level+1);
+            out+=i+1<array.size() ? ",\n" : "\n";
+        }
+        write_indent(out,level);
+        out.push_back(']');
+    }
+    else{
+        write_scalar(out,value);
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef WRITER_H
+#define WRITER_H
+
+#include <string>
+#include <boost/json.hpp>
+
+//JSON text of decoded records without reparsing them (Qt round trip of full command line tool),
+//keys keep decoder order, scalars are formatted as by boost::json::serialize
+
+//append compact JSON of value to out
+void write_compact(std::string& out, const boost::json::value& value);
+
+//append JSON of value indented by 4 spaces per level, level is indent of value itself
+void write_pretty(std::string& out, const boost::json::value& value, int level=0);
+
+#endif // WRITER_H
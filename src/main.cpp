@@ -1,45 +1,521 @@
+#include <map>
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdlib>
+#include <fstream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 #include <QJsonDocument>
+#include <boost/filesystem.hpp>
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/program_options.hpp>
+#include <boost/algorithm/string.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include "status.h"
+#include "dmi/cache.h"
+#include "dmi/query.h"
 #include "dmi/decoder.h"
+#include "dmi/columnar.h"
 #include "dmi/structure.h"
 
-int main(int argc,char* argv[]){
-    decoder dmi_decoder{};
+namespace po=boost::program_options;
+
+//layout of written records
+enum class output_format
+{
+    //indented JSON document per record
+    pretty,
+    //host header line, then one compact record per line
+    jsonl
+};
+
+//settings of one run, shared by all decoded hosts
+struct run_options
+{
+    const query* query_ {nullptr};
+    bool summary_only_ {false};
+    bool probes_only_ {false};
+    flags_format flags_ {flags_format::names};
+    raw_mode raw_ {raw_mode::none};
+    raw_encoding encoding_ {raw_encoding::base64};
+    bool canonical_ {false};
+    bool caches_ {false};
+    bool memory_ {false};
+    std::vector<int> types_ {};
+    output_format format_ {output_format::pretty};
+    //directory of columnar files, empty for JSON output
+    std::string columnar_ {};
+};
+
+void print_json(std::ostream& out,const std::string& json){
+    QJsonDocument doc=QJsonDocument::fromJson(QString::fromStdString(json).toUtf8());
+    out<<doc.toJson().toStdString();
+}
+
+//JSON lines: one compact document per line, flushed so consumers can start before decode ends
+void print_line(std::ostream& out,const std::string& json){
+    out<<json<<'\n'<<std::flush;
+}
+
+void print_record(std::ostream& out,output_format format,const std::string& json){
+    if(format==output_format::jsonl){
+        print_line(out,json);
+    }
+    else{
+        print_json(out,json);
+    }
+}
+
+//first record of host, JSON lines header carries object type for consumers splitting the stream
+std::string host_header(const std::string& host,output_format format){
+    if(format==output_format::jsonl){
+        const boost::json::object& host_object {
+            {"object_type", "host"},
+            {"host", host}
+        };
+        return boost::json::serialize(host_object);
+    }
+    const boost::json::object& host_object {{"host", host}};
+    return boost::json::serialize(host_object);
+}
+
+//run compiled query over raw structures, without full decode
+std::vector<std::pair<std::string,std::string>> query_information(decoder& dmi_decoder,const query& dmi_query){
+    std::vector<std::pair<std::string,std::string>> dmi_list {};
+    const std::vector<structure>& structures {dmi_decoder.read_structures()};
+    for(const boost::json::value& item: dmi_query.run(structures,dmi_decoder.version())){
+        dmi_list.push_back(std::make_pair("query",boost::json::serialize(item)));
+    }
+    return dmi_list;
+}
+
+//host totals only, without per structure records
+std::vector<std::pair<std::string,std::string>> summary_information(decoder& dmi_decoder){
+    std::vector<std::pair<std::string,std::string>> dmi_list {};
+    const summary& host_summary {dmi_decoder.decode_summary()};
+    if(host_summary.sockets_ || host_summary.memory_devices_ || host_summary.slots_){
+        dmi_list.push_back(std::make_pair("summary",boost::json::serialize(host_summary.to_json())));
+    }
+    return dmi_list;
+}
+
+//probe values only, without strings and names
+std::vector<std::pair<std::string,std::string>> probes_information(decoder& dmi_decoder){
+    std::vector<std::pair<std::string,std::string>> dmi_list {};
+    for(const probe& reading: dmi_decoder.decode_probes()){
+        dmi_list.push_back(std::make_pair("probe",boost::json::serialize(reading.to_json())));
+    }
+    return dmi_list;
+}
+
+void configure(decoder& dmi_decoder,const run_options& options){
+    dmi_decoder.set_flags_format(options.flags_);
+    dmi_decoder.set_raw_format(options.raw_,options.encoding_);
+    dmi_decoder.set_canonical(options.canonical_);
+    dmi_decoder.set_type_filter(options.types_);
+    dmi_decoder.set_cache_topology(options.caches_);
+    dmi_decoder.set_memory_topology(options.memory_);
+}
+
+exit_status host_status(const decoder& dmi_decoder,const run_options& options,std::size_t count,std::string& error);
+
+//decode one host, records go to sink as soon as decoded, error holds message of failed decode
+exit_status decode_host(decoder& dmi_decoder,const run_options& options,const record_sink& sink,std::string& error){
+    std::size_t count {0};
     try{
-        const std::vector<std::pair<std::string,std::string>>& dmi_list {dmi_decoder.decode_information()};
-        if(!dmi_list.empty()){
+        if(options.query_ || options.summary_only_ || options.probes_only_){
+            const std::vector<std::pair<std::string,std::string>>& dmi_list {
+                options.query_ ? query_information(dmi_decoder,*options.query_) :
+                options.summary_only_ ? summary_information(dmi_decoder) :
+                                        probes_information(dmi_decoder)};
             for(const std::pair<std::string,std::string>& dmi: dmi_list){
-                if(!dmi.second.empty()){
-                    QJsonDocument doc=QJsonDocument::fromJson(QString::fromStdString(dmi.second).toUtf8());
-                    std::cout<<doc.toJson().toStdString();
-
-                    //std::stringstream in_ss;
-                    //in_ss<<dmi_str;
-                    //boost::property_tree::ptree ptree_;
-                    //boost::property_tree::json_parser::read_json(in_ss,ptree_);
-
-                    //std::stringstream out__ss;
-                    //boost::property_tree::json_parser::write_json(out__ss,ptree_);
-                    //std::cout<<out__ss.str()<<std::endl;
-                }
+                sink(dmi.first,dmi.second);
             }
+            count=dmi_list.size();
         }
         else{
-            if(!dmi_decoder.error().empty()){
-                std::cerr<<dmi_decoder.error()<<std::endl;
-                std::getchar();
-                return EXIT_FAILURE;
+            count=dmi_decoder.decode_information(sink);
+        }
+    }catch(const std::exception& ex){
+        error=ex.what();
+        return exit_status::failure;
+    }
+    return host_status(dmi_decoder,options,count,error);
+}
+
+//exit status of decoded host with count records written
+exit_status host_status(const decoder& dmi_decoder,const run_options& options,std::size_t count,std::string& error){
+    //malformed tables keep structures read before error
+    if(!dmi_decoder.error().empty()){
+        error=dmi_decoder.error();
+        return error_status(dmi_decoder.error_code());
+    }
+    if(count==0 && !options.query_ && !options.probes_only_){
+        error="No structures decoded";
+        return exit_status::no_structures;
+    }
+    return exit_status::success;
+}
+
+//decode captured tables of many hosts in parallel, sharing one decode cache,
+//JSON lines output is written per host as soon as host is decoded instead of after all hosts
+exit_status batch_decode(const std::vector<std::string>& hosts,const run_options& options,std::ostream& out){
+    const std::shared_ptr<decode_cache>& cache {std::make_shared<decode_cache>()};
+    std::vector<std::vector<std::string>> results(hosts.size());
+    std::vector<std::string> errors(hosts.size());
+    std::vector<exit_status> statuses(hosts.size(),exit_status::success);
+    std::mutex output_mutex;
+    const bool jsonl {options.format_==output_format::jsonl};
+
+    std::atomic<std::size_t> next {0};
+    const unsigned workers_count {std::max(1u,std::thread::hardware_concurrency())};
+    std::vector<std::thread> workers;
+    for(unsigned i=0;i<workers_count;++i){
+        workers.emplace_back([&hosts,&results,&errors,&statuses,&next,&cache,&output_mutex,&options,&out,jsonl](){
+            for(std::size_t index=next++;index<hosts.size();index=next++){
+                const boost::filesystem::path& host {hosts.at(index)};
+                decoder host_decoder {(host / "smbios_entry_point").string(),(host / "DMI").string()};
+                host_decoder.set_cache(cache);
+                configure(host_decoder,options);
+
+                std::vector<std::string>& records {results.at(index)};
+                statuses.at(index)=decode_host(host_decoder,options,[&records](const std::string&, const std::string& json){
+                    records.push_back(json);
+                },errors.at(index));
+
+                if(jsonl){
+                    const std::lock_guard<std::mutex> lock {output_mutex};
+                    if(!errors.at(index).empty()){
+                        std::cerr<<hosts.at(index)<<": "<<errors.at(index)<<std::endl;
+                    }
+                    if(!records.empty()){
+                        print_line(out,host_header(hosts.at(index),options.format_));
+                        for(const std::string& json: records){
+                            print_line(out,json);
+                        }
+                    }
+                    //written records are not kept until end of run
+                    records.clear();
+                    records.shrink_to_fit();
+                }
+            }
+        });
+    }
+    for(std::thread& worker: workers){
+        worker.join();
+    }
+
+    //first failed host in command line order sets exit status
+    exit_status status {exit_status::success};
+    for(std::size_t index=0;index<hosts.size();++index){
+        if(status==exit_status::success){
+            status=statuses.at(index);
+        }
+        //JSON lines output and errors are already written by workers
+        if(jsonl){
+            continue;
+        }
+        if(!errors.at(index).empty()){
+            std::cerr<<hosts.at(index)<<": "<<errors.at(index)<<std::endl;
+            if(results.at(index).empty()){
+                continue;
             }
         }
+        print_json(out,host_header(hosts.at(index),options.format_));
+        for(const std::string& json: results.at(index)){
+            print_json(out,json);
+        }
+    }
+    return status;
+}
+
+//decode captured tables in parallel into one columnar file per object type. Rows carry host_id,
+//position of host on command line, hosts.dmicol maps host_id to host directory and decode error
+exit_status columnar_decode(const std::vector<std::string>& hosts,const run_options& options){
+    boost::system::error_code code {};
+    boost::filesystem::create_directories(options.columnar_,code);
+    if(code){
+        std::cerr<<"error: can not create directory "<<options.columnar_<<": "<<code.message()<<std::endl;
+        return exit_status::output;
+    }
+
+    const std::shared_ptr<decode_cache>& cache {std::make_shared<decode_cache>()};
+    std::vector<std::string> errors(hosts.size());
+    std::vector<exit_status> statuses(hosts.size(),exit_status::success);
+
+    std::atomic<std::size_t> next {0};
+    const unsigned workers_count {std::max(1u,std::thread::hardware_concurrency())};
+    //column builders per worker, merged after all hosts are decoded. Strings repeated across
+    //structures and hosts (manufacturers, part numbers, versions) are stored once in shared pool
+    const std::shared_ptr<string_pool>& pool {std::make_shared<string_pool>()};
+    std::vector<column_set> sets(workers_count,column_set {pool});
+    std::vector<std::thread> workers;
+    for(unsigned i=0;i<workers_count;++i){
+        workers.emplace_back([&hosts,&errors,&statuses,&next,&cache,&options,&sets,i](){
+            column_set& tables {sets.at(i)};
+            for(std::size_t index=next++;index<hosts.size();index=next++){
+                const boost::filesystem::path& host {hosts.at(index)};
+                decoder host_decoder {(host / "smbios_entry_point").string(),(host / "DMI").string()};
+                host_decoder.set_cache(cache);
+                configure(host_decoder,options);
+
+                const std::int64_t& host_id {static_cast<std::int64_t>(index)};
+                std::size_t count {0};
+                try{
+                    count=host_decoder.decode_objects([&tables,host_id](const boost::json::object& json){
+                        tables.append(host_id,json);
+                    });
+                }catch(const std::exception& ex){
+                    errors.at(index)=ex.what();
+                    statuses.at(index)=exit_status::failure;
+                    continue;
+                }
+                statuses.at(index)=host_status(host_decoder,options,count,errors.at(index));
+            }
+        });
+    }
+    for(std::thread& worker: workers){
+        worker.join();
+    }
+
+    //first failed host in command line order sets exit status
+    exit_status status {exit_status::success};
+    column_set& tables {sets.front()};
+    for(std::size_t index=0;index<hosts.size();++index){
+        if(status==exit_status::success){
+            status=statuses.at(index);
+        }
+        if(!errors.at(index).empty()){
+            std::cerr<<hosts.at(index)<<": "<<errors.at(index)<<std::endl;
+        }
+        const boost::json::object& host_object {
+            {"object_type", "hosts"},
+            {"host", hosts.at(index)},
+            {"error", errors.at(index)}
+        };
+        tables.append(static_cast<std::int64_t>(index),host_object);
+    }
+    for(std::size_t i=1;i<sets.size();++i){
+        tables.append_set(sets.at(i));
+        sets.at(i)=column_set {pool};
+    }
+
+    std::string error {};
+    if(!tables.write(options.columnar_,error)){
+        std::cerr<<"error: "<<error<<std::endl;
+        return exit_status::output;
+    }
+    return status;
+}
+
+//structure types from comma separated lists, false on value out of 0..255
+bool parse_types(const std::vector<std::string>& lists,std::vector<int>& types){
+    for(const std::string& list: lists){
+        std::vector<std::string> items;
+        boost::split(items,list,boost::is_any_of(","),boost::token_compress_on);
+        for(const std::string& item: items){
+            const std::string& value {boost::trim_copy(item)};
+            if(value.empty()){
+                continue;
+            }
+            char* end {nullptr};
+            const long type {std::strtol(value.c_str(),&end,10)};
+            if(*end!='\0' || type < 0 || type > 255){
+                return false;
+            }
+            types.push_back(static_cast<int>(type));
+        }
+    }
+    return true;
+}
+
+int main(int argc,char* argv[]){
+    po::options_description description {"Allowed options"};
+    description.add_options()
+        ("help,h", "produce help message")
+        ("input,i", po::value<std::string>(),
+         "decode captured table from directory holding smbios_entry_point and DMI files instead of running system")
+        ("batch,b", po::value<std::vector<std::string>>()->multitoken(),
+         "decode captured tables, each directory holds smbios_entry_point and DMI files")
+        ("output,o", po::value<std::string>(),
+         "write records to file instead of standard output")
+        ("format", po::value<std::string>()->default_value("pretty"),
+         "output format, \"pretty\" (indented document per record) or \"jsonl\" (host line, then one record per line)")
+        ("jsonl,l", "same as --format jsonl")
+        ("columnar", po::value<std::string>(),
+         "write one columnar file per structure type into directory, with --batch or --input")
+        ("type,t", po::value<std::vector<std::string>>()->multitoken(),
+         "decode only given structure types, e.g. \"-t 1,2,17\"")
+        ("query,q", po::value<std::string>(),
+         "print selected fields only, e.g. \"type 17 size,speed where size>0; type 1 uuid\"")
+        ("summary,s", "print memory, processor and slot totals only")
+        ("probes,p", "print voltage, cooling, temperature and current probe values only")
+        ("flags,f", po::value<std::string>()->default_value("names"),
+         "flags fields as \"names\" (joined names), \"raw\" (integer) or \"both\" (integer and names array)")
+        ("raw,r", po::value<std::string>()->default_value("none"),
+         "raw records of structures as \"none\", \"unknown\" (structures without decoder) or \"all\" (no decoding)")
+        ("raw-encoding", po::value<std::string>()->default_value("base64"),
+         "raw formatted area encoding, \"base64\" or \"hex\"")
+        ("canonical", "sort structures by type and handle, order keys and add xxh64 digests per structure and table")
+        ("caches,c", "append per socket cache topology to decoded structures")
+        ("memory,m", "append per array memory topology to decoded structures");
+
+    const std::string& exit_codes {
+        "Exit codes:\n"
+        "  0  success\n"
+        "  1  unexpected decode failure\n"
+        "  2  invalid command line\n"
+        "  3  entry point or structure table unreadable\n"
+        "  4  malformed entry point\n"
+        "  5  malformed structure table, structures before error are written\n"
+        "  6  no structures decoded\n"
+        "  7  output not writable"};
+
+    po::variables_map vm;
+    try{
+        po::store(po::parse_command_line(argc,argv,description),vm);
+        po::notify(vm);
     }catch(const std::exception& ex){
-        std::cout<<"error: "<<ex.what()<<std::endl;
+        std::cerr<<"error: "<<ex.what()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+
+    if(vm.count("help")){
+        std::cout<<description<<std::endl<<exit_codes<<std::endl;
+        return exit_code(exit_status::success);
     }
 
-    std::getchar();
-    return EXIT_SUCCESS;
+    if(vm.count("input") && vm.count("batch")){
+        std::cerr<<"error: --input and --batch can not be used together"<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+
+    run_options options {};
+
+    query dmi_query {};
+    if(vm.count("query") && !dmi_query.compile(vm.at("query").as<std::string>())){
+        std::cerr<<"error: "<<dmi_query.error()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+    options.query_=vm.count("query") ? &dmi_query : nullptr;
+    options.summary_only_=vm.count("summary")>0;
+    options.probes_only_=vm.count("probes")>0;
+
+    const std::map<std::string,flags_format>& flags_formats {
+        {"names", flags_format::names},
+        {"raw", flags_format::raw},
+        {"both", flags_format::raw_and_names}
+    };
+    const auto& flags_found {flags_formats.find(vm.at("flags").as<std::string>())};
+    if(flags_found==flags_formats.end()){
+        std::cerr<<"error: unknown flags format "<<vm.at("flags").as<std::string>()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+    options.flags_=flags_found->second;
+
+    const std::map<std::string,raw_mode>& raw_modes {
+        {"none", raw_mode::none},
+        {"unknown", raw_mode::unknown},
+        {"all", raw_mode::all}
+    };
+    const auto& raw_found {raw_modes.find(vm.at("raw").as<std::string>())};
+    if(raw_found==raw_modes.end()){
+        std::cerr<<"error: unknown raw mode "<<vm.at("raw").as<std::string>()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+    options.raw_=raw_found->second;
+
+    const std::map<std::string,raw_encoding>& raw_encodings {
+        {"base64", raw_encoding::base64},
+        {"hex", raw_encoding::hex}
+    };
+    const auto& encoding_found {raw_encodings.find(vm.at("raw-encoding").as<std::string>())};
+    if(encoding_found==raw_encodings.end()){
+        std::cerr<<"error: unknown raw encoding "<<vm.at("raw-encoding").as<std::string>()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+    options.encoding_=encoding_found->second;
+
+    const std::map<std::string,output_format>& output_formats {
+        {"pretty", output_format::pretty},
+        {"jsonl", output_format::jsonl}
+    };
+    const auto& format_found {output_formats.find(vm.at("format").as<std::string>())};
+    if(format_found==output_formats.end()){
+        std::cerr<<"error: unknown output format "<<vm.at("format").as<std::string>()<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+    options.format_=vm.count("jsonl") ? output_format::jsonl : format_found->second;
+
+    if(vm.count("type") && !parse_types(vm.at("type").as<std::vector<std::string>>(),options.types_)){
+        std::cerr<<"error: structure types must be numbers from 0 to 255"<<std::endl;
+        return exit_code(exit_status::usage);
+    }
+
+    if(vm.count("columnar")){
+        if(!vm.count("batch") && !vm.count("input")){
+            std::cerr<<"error: --columnar needs captured tables given by --batch or --input"<<std::endl;
+            return exit_code(exit_status::usage);
+        }
+        if(options.query_ || options.summary_only_ || options.probes_only_ || vm.count("output")){
+            std::cerr<<"error: --columnar can not be used with --query, --summary, --probes or --output"<<std::endl;
+            return exit_code(exit_status::usage);
+        }
+        options.columnar_=vm.at("columnar").as<std::string>();
+    }
+
+    options.canonical_=vm.count("canonical")>0;
+    options.caches_=vm.count("caches")>0;
+    options.memory_=vm.count("memory")>0;
+
+    std::ofstream file_out {};
+    if(vm.count("output")){
+        file_out.open(vm.at("output").as<std::string>(),std::ios::binary | std::ios::trunc);
+        if(!file_out.is_open()){
+            std::cerr<<"error: can not open output file "<<vm.at("output").as<std::string>()<<std::endl;
+            return exit_code(exit_status::output);
+        }
+    }
+    std::ostream& out {vm.count("output") ? static_cast<std::ostream&>(file_out) : std::cout};
+
+    exit_status status {exit_status::success};
+    if(!options.columnar_.empty()){
+        status=columnar_decode(vm.count("batch") ? vm.at("batch").as<std::vector<std::string>>() :
+                                                   std::vector<std::string> {vm.at("input").as<std::string>()},options);
+    }
+    else if(vm.count("batch")){
+        status=batch_decode(vm.at("batch").as<std::vector<std::string>>(),options,out);
+    }
+    else{
+        const bool captured {vm.count("input")>0};
+        const boost::filesystem::path& host {captured ? vm.at("input").as<std::string>() : std::string {}};
+        const std::unique_ptr<decoder> dmi_decoder {captured ? new decoder {(host / "smbios_entry_point").string(),(host / "DMI").string()} :
+                                                               new decoder {}};
+        configure(*dmi_decoder,options);
+
+        //JSON lines header names host before its records, pretty output of one host has no header
+        if(options.format_==output_format::jsonl){
+            print_line(out,host_header(captured ? host.string() : boost::asio::ip::host_name(),options.format_));
+        }
+        std::string error {};
+        status=decode_host(*dmi_decoder,options,[&out,&options](const std::string&, const std::string& json){
+            print_record(out,options.format_,json);
+        },error);
+        if(!error.empty()){
+            std::cerr<<"error: "<<error<<std::endl;
+        }
+    }
+
+    out.flush();
+    if(!out){
+        std::cerr<<"error: fail to write output"<<std::endl;
+        return exit_code(exit_status::output);
+    }
+    return exit_code(status);
 }
@@ -0,0 +1,50 @@
+#ifndef STATUS_H
+#define STATUS_H
+
+#include "dmi/result.h"
+
+//process exit codes, one per failure class, shared by full and minimal command line tools
+enum class exit_status
+{
+    success=0,
+    //unexpected exception while decoding
+    failure=1,
+    //invalid command line
+    usage=2,
+    //entry point or structure table missing or unreadable
+    unreadable=3,
+    //entry point anchor or length malformed
+    bad_entry=4,
+    //malformed structure in table, structures before it are written
+    bad_table=5,
+    //table holds no decodable structures
+    no_structures=6,
+    //output file can not be opened or written
+    output=7
+};
+
+inline int exit_code(exit_status status){
+    return static_cast<int>(status);
+}
+
+//exit status of decoder error
+inline exit_status error_status(decode_error error){
+    switch(error){
+    case decode_error::ok:
+        return exit_status::failure;
+    case decode_error::entry_unreadable:
+    case decode_error::table_unreadable:
+        return exit_status::unreadable;
+    case decode_error::entry_anchor:
+    case decode_error::entry_length:
+        return exit_status::bad_entry;
+    case decode_error::truncated_header:
+    case decode_error::short_length:
+    case decode_error::area_past_end:
+    case decode_error::unterminated_strings:
+        return exit_status::bad_table;
+    }
+    return exit_status::failure;
+}
+
+#endif // STATUS_H
@@ -0,0 +1,80 @@
+//Identity benchmark: latency of read_identity fast path against full decode of same captured table, e.g.
+//  dmidecoder_identity_bench 10000 tables/host
+//Fast path is timed on files (entry point and table read per call) and on table held in memory.
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include "dmi/decoder.h"
+#include "dmi/identity.h"
+
+namespace {
+//microseconds of each of runs calls
+std::vector<double> time_calls(int runs, const std::function<void()>& call)
+{
+    std::vector<double> times {};
+    times.reserve(static_cast<std::size_t>(runs));
+    for(int i=0;i<runs;++i){
+        const std::chrono::steady_clock::time_point& start {std::chrono::steady_clock::now()};
+        call();
+        const std::chrono::steady_clock::time_point& end {std::chrono::steady_clock::now()};
+        times.push_back(std::chrono::duration<double,std::micro>(end-start).count());
+    }
+    std::sort(times.begin(),times.end());
+    return times;
+}
+
+void print_line(const char* name, const std::vector<double>& times)
+{
+    std::printf("%-20s p50 %10.2f  p90 %10.2f  p99 %10.2f us\n",name,
+                times[times.size()/2],times[times.size()*9/10],times[times.size()*99/100]);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    const int runs {argc==3 ? std::atoi(argv[1]) : 0};
+    if(runs<=0){
+        std::fprintf(stderr,"usage: identity_bench <runs> <directory with smbios_entry_point and DMI>\n");
+        return EXIT_FAILURE;
+    }
+    const std::string& directory {argv[2]};
+    const std::string& entry_path {directory+"/smbios_entry_point"};
+    const std::string& table_path {directory+"/DMI"};
+
+    std::ifstream table_file {table_path,std::ios::binary};
+    const std::vector<char> table {std::istreambuf_iterator<char> {table_file},std::istreambuf_iterator<char> {}};
+    std::ifstream entry_file {entry_path,std::ios::binary};
+    const std::vector<char> entry_point {std::istreambuf_iterator<char> {entry_file},std::istreambuf_iterator<char> {}};
+    const bool& sm3 {entry_point.size()>8 && entry_point[3]=='3'};
+    const int& major {entry_point.size()>8 ? static_cast<unsigned char>(entry_point[sm3 ? 7 : 6]) : 0};
+    const int& minor {entry_point.size()>8 ? static_cast<unsigned char>(entry_point[sm3 ? 8 : 7]) : 0};
+
+    system_identity identity {};
+    const decode_error& error {read_identity(entry_path,table_path,identity)};
+    if(error!=decode_error::ok){
+        std::fprintf(stderr,"identity_bench: %s\n",error_message(error));
+        return EXIT_FAILURE;
+    }
+    std::printf("uuid %s, serial %s, product %s, baseboard %s, chassis %s\n",identity.uuid_,identity.serial_number_,
+                identity.product_name_,identity.baseboard_serial_number_,identity.chassis_serial_number_);
+
+    print_line("identity files",time_calls(runs,[&entry_path,&table_path,&identity](){
+        read_identity(entry_path,table_path,identity);
+    }));
+    print_line("identity memory",time_calls(runs,[&table,major,minor,&identity](){
+        read_identity(table.data(),table.size(),major,minor,identity);
+    }));
+    //full decode is much slower, fewer runs keep benchmark short
+    print_line("decode_information",time_calls(std::max(1,runs/10),[&entry_path,&table_path](){
+        decoder dmi_decoder {entry_path,table_path};
+        dmi_decoder.decode_information();
+    }));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,237 @@
+//Name tables generator: compiles names.spec into names.h and names.cpp.
+//All names are stored once in one read-only blob, tables hold key and blob offset pairs,
+//so tables need no relocations or static initialization and are shared by all threads.
+//
+//Spec format, one item per line:
+//  # comment
+//  [table_name] description of table
+//  <key> <name>
+//Keys are decimal or 0x hexadecimal, ascending in each table. Name is rest of line, UTF-8,
+//names that are empty or have leading or trailing spaces are written in double quotes.
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+namespace {
+struct spec_entry
+{
+    unsigned long long key_ {0};
+    std::string name_ {};
+};
+
+struct spec_table
+{
+    std::string name_ {};
+    std::string description_ {};
+    std::vector<spec_entry> entries_ {};
+};
+
+std::string trim(const std::string& value)
+{
+    const std::size_t& begin {value.find_first_not_of(" \t\r")};
+    if(begin==std::string::npos){
+        return std::string {};
+    }
+    const std::size_t& end {value.find_last_not_of(" \t\r")};
+    return value.substr(begin,end-begin+1);
+}
+
+bool is_identifier(const std::string& value)
+{
+    if(value.empty() || (value[0]>='0' && value[0]<='9')){
+        return false;
+    }
+    for(char item: value){
+        if(!((item>='a' && item<='z') || (item>='A' && item<='Z') || (item>='0' && item<='9') || item=='_')){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parse_spec(std::istream& in, std::vector<spec_table>& tables, std::string& error)
+{
+    std::string line {};
+    int line_number {0};
+    while(std::getline(in,line)){
+        ++line_number;
+        const std::string& item {trim(line)};
+        if(item.empty() || item[0]=='#'){
+            continue;
+        }
+        std::ostringstream position;
+        position<<"line "<<line_number<<": ";
+
+        if(item[0]=='['){
+            const std::size_t& close {item.find(']')};
+            spec_table table {};
+            table.name_=close==std::string::npos ? std::string {} : item.substr(1,close-1);
+            if(!is_identifier(table.name_)){
+                error=position.str()+"invalid table name";
+                return false;
+            }
+            for(const spec_table& other: tables){
+                if(other.name_==table.name_){
+                    error=position.str()+"duplicate table "+table.name_;
+                    return false;
+                }
+            }
+            table.description_=trim(item.substr(close+1));
+            tables.push_back(table);
+            continue;
+        }
+
+        if(tables.empty()){
+            error=position.str()+"entry outside of table";
+            return false;
+        }
+        const std::size_t& separator {item.find_first_of(" \t")};
+        if(separator==std::string::npos){
+            error=position.str()+"entry without name";
+            return false;
+        }
+        const std::string& key_text {item.substr(0,separator)};
+        char* end {nullptr};
+        spec_entry entry {};
+        entry.key_=std::strtoull(key_text.c_str(),&end,0);
+        entry.name_=trim(item.substr(separator));
+        if(*end!='\0' || entry.name_.empty()){
+            error=position.str()+"invalid entry";
+            return false;
+        }
+        //quoted name is taken verbatim
+        if(entry.name_.size()>=2 && entry.name_.front()=='"' && entry.name_.back()=='"'){
+            entry.name_=entry.name_.substr(1,entry.name_.size()-2);
+        }
+        //names are found by binary search, keys must ascend
+        std::vector<spec_entry>& entries {tables.back().entries_};
+        if(!entries.empty() && entries.back().key_ >= entry.key_){
+            error=position.str()+"keys of table "+tables.back().name_+" are not ascending";
+            return false;
+        }
+        if(entry.key_ > 0xFFFFFFFFULL){
+            error=position.str()+"key does not fit 32 bits";
+            return false;
+        }
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+//name as C comment text
+std::string comment_text(const std::string& name)
+{
+    std::string out {name};
+    for(std::size_t position=out.find("*/");position!=std::string::npos;position=out.find("*/")){
+        out.replace(position,2,"* /");
+    }
+    return out;
+}
+
+bool write_header(const std::string& path, const std::vector<spec_table>& tables)
+{
+    std::ofstream out {path,std::ios::binary | std::ios::trunc};
+    out<<"//generated by namegen from names.spec, do not edit\n"
+       <<"#ifndef NAMES_H\n"
+       <<"#define NAMES_H\n\n"
+       <<"#include \"dmi/layout.h\"\n";
+    for(const spec_table& table: tables){
+        out<<"\n";
+        if(!table.description_.empty()){
+            out<<"//"<<table.description_<<"\n";
+        }
+        out<<"extern const name_entry "<<table.name_<<"["<<table.entries_.size()<<"];\n";
+    }
+    out<<"\n#endif // NAMES_H\n";
+    return static_cast<bool>(out.flush());
+}
+
+bool write_source(const std::string& path, const std::vector<spec_table>& tables)
+{
+    //names repeated across tables ("Other", "Unknown", "Reserved") are stored once
+    std::map<std::string,std::size_t> offsets {};
+    std::vector<std::string> blob_names {};
+    std::size_t blob_size {0};
+    for(const spec_table& table: tables){
+        for(const spec_entry& entry: table.entries_){
+            if(offsets.emplace(entry.name_,blob_size).second){
+                blob_names.push_back(entry.name_);
+                blob_size+=entry.name_.size()+1;
+            }
+        }
+    }
+    if(blob_size > 0xFFFFFFFFULL){
+        return false;
+    }
+
+    std::ofstream out {path,std::ios::binary | std::ios::trunc};
+    out<<"//generated by namegen from names.spec, do not edit\n"
+       <<"#include \"names.h\"\n\n"
+       <<"//zero terminated names of all tables, bytes instead of string literal to stay within compiler limits\n"
+       <<"const char name_blob[] {\n";
+    std::size_t offset {0};
+    for(const std::string& name: blob_names){
+        out<<"    /*"<<offset<<" "<<comment_text(name)<<"*/ ";
+        //bytes above 0x7F as character literals, they narrow where char is signed
+        for(unsigned char item: name){
+            if(item < 0x80){
+                out<<static_cast<int>(item)<<",";
+            }
+            else{
+                out<<"'\\x"<<std::hex<<static_cast<int>(item)<<std::dec<<"',";
+            }
+        }
+        out<<"0,\n";
+        offset+=name.size()+1;
+    }
+    out<<"};\n";
+
+    for(const spec_table& table: tables){
+        out<<"\nconst name_entry "<<table.name_<<"["<<table.entries_.size()<<"] {\n";
+        for(std::size_t i=0;i<table.entries_.size();++i){
+            const spec_entry& entry {table.entries_[i]};
+            out<<"    {0x"<<std::hex<<std::uppercase<<entry.key_<<std::dec<<","<<offsets.at(entry.name_)<<"}"
+               <<(i+1<table.entries_.size() ? "," : "")<<"\n";
+        }
+        out<<"};\n";
+    }
+    return static_cast<bool>(out.flush());
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc!=3){
+        std::cerr<<"usage: namegen <names.spec> <output directory>"<<std::endl;
+        return EXIT_FAILURE;
+    }
+    std::ifstream in {argv[1],std::ios::binary};
+    if(!in.is_open()){
+        std::cerr<<"namegen: can not open "<<argv[1]<<std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<spec_table> tables {};
+    std::string error {};
+    if(!parse_spec(in,tables,error)){
+        std::cerr<<argv[1]<<": "<<error<<std::endl;
+        return EXIT_FAILURE;
+    }
+    for(const spec_table& table: tables){
+        if(table.entries_.empty()){
+            std::cerr<<argv[1]<<": table "<<table.name_<<" is empty"<<std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::string& directory {argv[2]};
+    if(!write_header(directory+"/names.h",tables) || !write_source(directory+"/names.cpp",tables)){
+        std::cerr<<"namegen: can not write output to "<<directory<<std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
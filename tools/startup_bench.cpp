@@ -0,0 +1,135 @@
+//Startup benchmark: time from fork and exec of command to first byte on its standard output,
+//and to its exit, over repeated runs. Compares full and minimal builds on the same input, e.g.
+//  startup_bench 200 ./dmidecoder -l -i tables/host
+//  startup_bench 200 ./dmidecoder_min -l -i tables/host
+//POSIX only.
+#include <vector>
+#include <string>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+namespace {
+struct run_times
+{
+    //microseconds from fork to first output byte, 0 if command wrote nothing
+    double first_byte_ {0};
+    //microseconds from fork to exit
+    double exit_ {0};
+    int status_ {0};
+};
+
+double now_us()
+{
+    timespec time {};
+    clock_gettime(CLOCK_MONOTONIC,&time);
+    return static_cast<double>(time.tv_sec)*1e6+static_cast<double>(time.tv_nsec)/1e3;
+}
+
+//run command once with standard output on pipe, standard error discarded
+bool run_once(char* const command[], run_times& times)
+{
+    int pipe_ends[2];
+    if(pipe(pipe_ends)!=0){
+        return false;
+    }
+    const double& start {now_us()};
+    const pid_t child {fork()};
+    if(child<0){
+        close(pipe_ends[0]);
+        close(pipe_ends[1]);
+        return false;
+    }
+    if(child==0){
+        dup2(pipe_ends[1],STDOUT_FILENO);
+        const int null_fd {open("/dev/null",O_WRONLY)};
+        if(null_fd>=0){
+            dup2(null_fd,STDERR_FILENO);
+        }
+        close(pipe_ends[0]);
+        close(pipe_ends[1]);
+        execvp(command[0],command);
+        _exit(127);
+    }
+    close(pipe_ends[1]);
+
+    char buffer[65536];
+    bool first {true};
+    for(;;){
+        const ssize_t& count {read(pipe_ends[0],buffer,sizeof(buffer))};
+        if(count>0 && first){
+            times.first_byte_=now_us()-start;
+            first=false;
+        }
+        if(count==0 || (count<0 && errno!=EINTR)){
+            break;
+        }
+    }
+    close(pipe_ends[0]);
+    waitpid(child,&times.status_,0);
+    times.exit_=now_us()-start;
+    return true;
+}
+
+//nearest rank percentile of sorted values
+double percentile(const std::vector<double>& sorted, double rank)
+{
+    if(sorted.empty()){
+        return 0;
+    }
+    const std::size_t& index {static_cast<std::size_t>(rank*static_cast<double>(sorted.size()-1)+0.5)};
+    return sorted[std::min(index,sorted.size()-1)];
+}
+
+void print_line(const char* name, std::vector<double> values)
+{
+    std::sort(values.begin(),values.end());
+    std::printf("%-12s min %10.1f  p50 %10.1f  p90 %10.1f  p99 %10.1f  max %10.1f us\n",name,
+                percentile(values,0),percentile(values,0.5),percentile(values,0.9),percentile(values,0.99),
+                percentile(values,1));
+}
+}
+
+int main(int argc, char* argv[])
+{
+    const int runs {argc>2 ? std::atoi(argv[1]) : 0};
+    if(runs<=0){
+        std::fprintf(stderr,"usage: startup_bench <runs> <command> [arguments...]\n");
+        return EXIT_FAILURE;
+    }
+    char* const* command {argv+2};
+
+    //first run warms page cache and dynamic loader caches, not counted
+    run_times times {};
+    if(!run_once(command,times)){
+        std::perror("startup_bench");
+        return EXIT_FAILURE;
+    }
+    if(!WIFEXITED(times.status_) || WEXITSTATUS(times.status_)==127){
+        std::fprintf(stderr,"startup_bench: can not run %s\n",command[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<double> first_byte {};
+    std::vector<double> exit {};
+    for(int i=0;i<runs;++i){
+        if(!run_once(command,times)){
+            std::perror("startup_bench");
+            return EXIT_FAILURE;
+        }
+        if(times.first_byte_>0){
+            first_byte.push_back(times.first_byte_);
+        }
+        exit.push_back(times.exit_);
+    }
+
+    std::printf("%s, %d runs, exit status %d\n",command[0],runs,WEXITSTATUS(times.status_));
+    print_line("first byte",first_byte);
+    print_line("exit",exit);
+    return EXIT_SUCCESS;
+}